@@ -495,6 +495,16 @@ static inline uint32_t arch_proc_id(void);
  */
 void arch_sched_ipi(void);
 
+/**
+ * Direct an interrupt to a set of CPUs
+ *
+ * This will invoke z_sched_ipi() on the CPUs in @a cpu_bitmap only.
+ * Only available if CONFIG_ARCH_HAS_DIRECTED_IPIS is selected.
+ *
+ * @param cpu_bitmap A bitmap of CPUs, indexed by Zephyr CPU ID, to interrupt
+ */
+void arch_sched_directed_ipi(uint32_t cpu_bitmap);
+
 
 int arch_smp_init(void);
 
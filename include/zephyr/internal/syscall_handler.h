@@ -92,6 +92,29 @@ static inline bool k_is_in_user_syscall(void)
 int k_object_validate(struct k_object *ko, enum k_objects otype,
 		      enum _obj_init_check init);
 
+/**
+ * Look up a kernel object and validate it for the calling thread
+ *
+ * Equivalent to k_object_validate(k_object_find(obj), otype, init). With
+ * CONFIG_OBJ_VALIDATION_CACHE, an object which the calling thread recently
+ * validated is found in its validation cache instead, skipping both the
+ * lookup and the permission check.
+ *
+ * @param obj Address of the kernel object
+ * @param ko_ptr [out] Kernel object metadata, NULL if @a obj is not a kernel
+ *		 object
+ * @param otype Expected type of the kernel object, or K_OBJ_ANY if type
+ *	  doesn't matter
+ * @param init Indicate whether the object needs to already be in initialized
+ *             or uninitialized state, or that we don't care
+ * @note This is an internal API. Do not use unless you are extending
+ *       functionality in the Zephyr tree.
+ *
+ * @return Same as k_object_validate()
+ */
+int k_object_find_validate(const void *obj, struct k_object **ko_ptr,
+			   enum k_objects otype, enum _obj_init_check init);
+
 /**
  * Dump out error information on failed k_object_validate() call
  *
@@ -539,11 +562,28 @@ static inline int k_object_validation_check(struct k_object *ko,
 	return ret;
 }
 
+static inline int k_object_syscall_check(const void *obj,
+					 enum k_objects otype,
+					 enum _obj_init_check init)
+{
+	struct k_object *ko;
+	int ret;
+
+	ret = k_object_find_validate(obj, &ko, otype, init);
+
+#ifdef CONFIG_LOG
+	if (ret != 0) {
+		k_object_dump_error(ret, obj, ko, otype);
+	}
+#endif
+
+	return ret;
+}
+
 #define K_SYSCALL_IS_OBJ(ptr, type, init) \
-	K_SYSCALL_VERIFY_MSG(k_object_validation_check(			\
-				     k_object_find((const void *)ptr),	\
-				     (const void *)ptr,			\
-				     type, init) == 0, "access denied")
+	K_SYSCALL_VERIFY_MSG(k_object_syscall_check((const void *)ptr,	\
+						    type, init) == 0,	\
+			     "access denied")
 
 /**
  * @brief Runtime check driver object pointer for presence of operation
@@ -883,6 +883,81 @@ __syscall void k_thread_priority_set(k_tid_t thread, int prio);
 __syscall void k_thread_deadline_set(k_tid_t thread, int deadline);
 #endif
 
+#ifdef CONFIG_SCHED_DEADLINE_PERIODIC
+/**
+ * @brief Deadline statistics of a periodic thread
+ */
+struct k_thread_period_stats {
+	/** Jobs completed with k_thread_period_wait() */
+	uint32_t jobs;
+	/** Jobs completed after their deadline */
+	uint32_t misses;
+	/** Periods in which the thread ran out of budget */
+	uint32_t overruns;
+};
+
+/**
+ * @brief Give a thread a periodic reservation
+ *
+ * The thread is given @p budget cycles of execution time in every
+ * @p period, to be used by @p deadline cycles after the start of the
+ * period.  The first period starts now.  The scheduler maintains the
+ * thread's deadline (see k_thread_deadline_set()) as the end of the
+ * current job, and within its static priority the thread runs ahead
+ * of threads without a reservation.  Once it has used up its budget,
+ * it only runs when no other thread of its priority is ready, until
+ * its next period starts.  A thread normally completes each job with
+ * k_thread_period_wait().
+ *
+ * The reservation is refused if the total utilization of all periodic
+ * threads, counting each as @p budget / min(@p deadline, @p period),
+ * would exceed @kconfig{CONFIG_SCHED_DEADLINE_UTILIZATION_BOUND}
+ * percent.  A @p period of 0 removes the thread's reservation.
+ *
+ * @note The budget is only enforced on preemptible threads.
+ *
+ * @note You should enable @kconfig{CONFIG_SCHED_DEADLINE_PERIODIC} in
+ * your project configuration.
+ *
+ * @param thread A thread on which to set the reservation
+ * @param period Period in cycle units, less than 2^31
+ * @param budget Execution time per period in cycle units
+ * @param deadline Deadline relative to the start of the period in
+ *                 cycle units, 0 for the end of the period
+ *
+ * @retval 0 On success
+ * @retval -EINVAL The parameters are inconsistent
+ * @retval -EBUSY The reservation would exceed the utilization bound
+ */
+__syscall int k_thread_period_set(k_tid_t thread, uint32_t period,
+				  uint32_t budget, uint32_t deadline);
+
+/**
+ * @brief Complete the current job of a periodic thread
+ *
+ * Counts a deadline miss if the job completed after its deadline, and
+ * sleeps until the next period of the calling thread starts, with a
+ * replenished budget.  If that moment has already passed, a job is
+ * released for the current period right away.
+ *
+ * @retval 0 On the start of the next job
+ * @retval -EINVAL The calling thread has no periodic reservation
+ * @retval -EAGAIN Woken up by k_wakeup() before the next period
+ */
+__syscall int k_thread_period_wait(void);
+
+/**
+ * @brief Get the deadline statistics of a periodic thread
+ *
+ * The statistics are reset by k_thread_period_set().
+ *
+ * @param thread A thread
+ * @param stats Returns the statistics
+ */
+__syscall void k_thread_period_stats_get(k_tid_t thread,
+					 struct k_thread_period_stats *stats);
+#endif /* CONFIG_SCHED_DEADLINE_PERIODIC */
+
 #ifdef CONFIG_SCHED_CPU_MASK
 /**
  * @brief Sets all CPU enable masks to zero
@@ -1573,6 +1648,46 @@ void k_timer_init(struct k_timer *timer,
 __syscall void k_timer_start(struct k_timer *timer,
 			     k_timeout_t duration, k_timeout_t period);
 
+/**
+ * @brief Start a timer that may expire late.
+ *
+ * This routine is the same as k_timer_start(), except that each
+ * expiry of the timer may be delayed by up to @a slack.  With
+ * @kconfig{CONFIG_TIMEOUT_SLACK} enabled, the kernel uses that freedom
+ * to handle the expiries of several timeouts in a single timer
+ * interrupt.  Periodic expiries are delayed individually and do not
+ * drift.  Without @kconfig{CONFIG_TIMEOUT_SLACK}, the slack is ignored.
+ *
+ * @param timer     Address of timer.
+ * @param duration  Initial timer duration.
+ * @param period    Timer period.
+ * @param slack     Maximum delay of each expiry, K_NO_WAIT for none.
+ */
+__syscall void k_timer_start_slack(struct k_timer *timer,
+				   k_timeout_t duration, k_timeout_t period,
+				   k_timeout_t slack);
+
+#ifdef CONFIG_TIMEOUT_SLACK
+/**
+ * @brief Timeout coalescing statistics
+ */
+struct k_timeout_slack_stats {
+	/** Timer announcements that expired at least one timeout */
+	uint32_t wakeups;
+	/** Later expiry ticks handled by those announcements, each a
+	 *  wakeup that slack made unnecessary
+	 */
+	uint32_t merged;
+};
+
+/**
+ * @brief Get the timeout coalescing statistics.
+ *
+ * @param stats Returns the statistics since boot.
+ */
+__syscall void k_timeout_slack_stats_get(struct k_timeout_slack_stats *stats);
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 /**
  * @brief Stop a timer.
  *
@@ -1851,6 +1966,10 @@ struct k_queue {
 	sys_sflist_t data_q;
 	struct k_spinlock lock;
 	_wait_q_t wait_q;
+#ifdef CONFIG_QUEUE_ATOMIC_FAST_PATH
+	/* Items put without the lock, newest first, not yet in data_q */
+	atomic_ptr_t inbox;
+#endif /* CONFIG_QUEUE_ATOMIC_FAST_PATH */
 
 	Z_DECL_POLL_EVENT
 
@@ -1869,6 +1988,9 @@ struct k_queue {
 	Z_POLL_EVENT_OBJ_INIT(obj)		\
 	}
 
+/* Inbox value while threads may be pending on the queue */
+#define Z_QUEUE_INBOX_CONTENDED ((void *)0x1)
+
 /**
  * INTERNAL_HIDDEN @endcond
  */
@@ -2089,6 +2211,12 @@ __syscall int k_queue_is_empty(struct k_queue *queue);
 
 static inline int z_impl_k_queue_is_empty(struct k_queue *queue)
 {
+#ifdef CONFIG_QUEUE_ATOMIC_FAST_PATH
+	if ((uintptr_t)atomic_ptr_get(&queue->inbox) >
+	    (uintptr_t)Z_QUEUE_INBOX_CONTENDED) {
+		return 0;
+	}
+#endif /* CONFIG_QUEUE_ATOMIC_FAST_PATH */
 	return (int)sys_sflist_is_empty(&queue->data_q);
 }
 
@@ -2894,6 +3022,7 @@ __syscall int k_stack_pop(struct k_stack *stack, stack_data_t *data,
 
 struct k_work;
 struct k_work_q;
+struct k_work_q_worker;
 struct k_work_queue_config;
 extern struct k_work_q k_sys_work_q;
 
@@ -3110,7 +3239,11 @@ __syscall int k_condvar_wait(struct k_condvar *condvar, struct k_mutex *mutex,
 
 struct k_sem {
 	_wait_q_t wait_q;
+#ifdef CONFIG_SEM_ATOMIC_FAST_PATH
+	atomic_t count;
+#else
 	unsigned int count;
+#endif /* CONFIG_SEM_ATOMIC_FAST_PATH */
 	unsigned int limit;
 
 	Z_DECL_POLL_EVENT
@@ -3200,6 +3333,21 @@ __syscall int k_sem_take(struct k_sem *sem, k_timeout_t timeout);
  */
 __syscall void k_sem_give(struct k_sem *sem);
 
+/**
+ * @brief Give a semaphore multiple times.
+ *
+ * This routine gives @a sem @a count times, as if k_sem_give() was called
+ * in a loop, except that all woken up threads are made ready in one batch
+ * and the caller is rescheduled at most once. Gives beyond the maximum
+ * permitted count are discarded.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param sem Address of the semaphore.
+ * @param count Number of times to give the semaphore.
+ */
+__syscall void k_sem_give_n(struct k_sem *sem, unsigned int count);
+
 /**
  * @brief Resets a semaphore's count to zero.
  *
@@ -3227,7 +3375,14 @@ __syscall unsigned int k_sem_count_get(struct k_sem *sem);
  */
 static inline unsigned int z_impl_k_sem_count_get(struct k_sem *sem)
 {
+#ifdef CONFIG_SEM_ATOMIC_FAST_PATH
+	/* Negative while threads are pending on the semaphore */
+	atomic_val_t count = atomic_get(&sem->count);
+
+	return (count > 0) ? (unsigned int)count : 0U;
+#else
 	return sem->count;
+#endif /* CONFIG_SEM_ATOMIC_FAST_PATH */
 }
 
 /**
@@ -3469,6 +3624,53 @@ void k_work_queue_start(struct k_work_q *queue,
 			k_thread_stack_t *stack, size_t stack_size,
 			int prio, const struct k_work_queue_config *cfg);
 
+#if defined(CONFIG_WORKQUEUE_WORK_STEALING) || defined(__DOXYGEN__)
+/** @brief Initialize a work queue animated by several threads.
+ *
+ * This configures a work queue processed by @p num_workers threads,
+ * typically one per CPU, and starts them running.  Each worker has its
+ * own list of pending items: items are submitted to the list of the
+ * worker associated with the submitting CPU (or to the worker's own
+ * list for chained submissions), and idle workers steal items from the
+ * other lists.  Work items submitted to such a queue keep the usual
+ * guarantees: a handler is never run concurrently with itself, and
+ * flush, cancel and drain operations behave as for k_work_queue_start().
+ *
+ * Note that unlike with a single threaded queue, items submitted to
+ * the queue may run concurrently with, and complete in a different
+ * order than, each other.
+ *
+ * With CONFIG_SCHED_CPU_MASK the worker threads are pinned to the CPUs
+ * in order.
+ *
+ * @param queue pointer to the queue structure. It must be initialized
+ *        in zeroed/bss memory or with @ref k_work_queue_init before
+ *        use.
+ *
+ * @param workers array of @p num_workers worker structures.
+ *
+ * @param num_workers number of worker threads.
+ *
+ * @param stacks the stack array for the worker threads, defined with
+ *        K_THREAD_STACK_ARRAY_DEFINE() with at least @p num_workers
+ *        elements of @p stack_size bytes.
+ *
+ * @param stack_size size of each worker thread stack, in bytes, as
+ *        passed to K_THREAD_STACK_ARRAY_DEFINE().
+ *
+ * @param prio initial thread priority
+ *
+ * @param cfg optional additional configuration parameters.  Pass @c
+ * NULL if not required, to use the defaults documented in
+ * k_work_queue_config.
+ */
+void k_work_queue_start_workers(struct k_work_q *queue,
+				struct k_work_q_worker *workers,
+				size_t num_workers,
+				k_thread_stack_t *stacks, size_t stack_size,
+				int prio, const struct k_work_queue_config *cfg);
+#endif /* CONFIG_WORKQUEUE_WORK_STEALING */
+
 /** @brief Access the thread that animates a work queue.
  *
  * This is necessary to grant a work queue thread access to things the work
@@ -3476,7 +3678,8 @@ void k_work_queue_start(struct k_work_q *queue,
  *
  * @param queue pointer to the queue structure.
  *
- * @return the thread associated with the work queue.
+ * @return the thread associated with the work queue.  For a queue started
+ * with k_work_queue_start_workers(), the thread of the first worker.
  */
 static inline k_tid_t k_work_queue_thread_get(struct k_work_q *queue);
 
@@ -3550,6 +3753,24 @@ void k_work_init_delayable(struct k_work_delayable *dwork,
 static inline struct k_work_delayable *
 k_work_delayable_from_work(struct k_work *work);
 
+/** @brief Let a delayable work item be submitted late.
+ *
+ * Future schedules of the work item may submit it up to @p slack after
+ * its delay has elapsed.  With @kconfig{CONFIG_TIMEOUT_SLACK} enabled,
+ * the kernel uses that freedom to handle the expiries of several
+ * timeouts in a single timer interrupt.  Without it, the slack is
+ * ignored.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param dwork pointer to the delayable work item.
+ *
+ * @param slack maximum delay of the submission, K_NO_WAIT for none,
+ * which is the default.
+ */
+void k_work_delayable_slack_set(struct k_work_delayable *dwork,
+				k_timeout_t slack);
+
 /** @brief Busy state flags from the delayable work item.
  *
  * @funcprops \isr_ok
@@ -4023,6 +4244,30 @@ struct k_work_queue_config {
 	bool essential;
 };
 
+#ifdef CONFIG_WORKQUEUE_WORK_STEALING
+/** @brief A thread of a work queue started with k_work_queue_start_workers(). */
+struct k_work_q_worker {
+	/* The thread that animates this worker. */
+	struct k_thread thread;
+
+	/* All the following fields must be accessed only while the
+	 * work module spinlock is held.
+	 */
+
+	/* The queue this worker belongs to. */
+	struct k_work_q *queue;
+
+	/* List of k_work items submitted to this worker. */
+	sys_slist_t pending;
+
+	/* Wait queue for the idle worker thread. */
+	_wait_q_t notifyq;
+
+	/* The work item being processed, or NULL. */
+	struct k_work *current;
+};
+#endif /* CONFIG_WORKQUEUE_WORK_STEALING */
+
 /** @brief A structure used to hold work until it can be processed. */
 struct k_work_q {
 	/* The thread that animates the work. */
@@ -4043,6 +4288,17 @@ struct k_work_q {
 
 	/* Flags describing queue state. */
 	uint32_t flags;
+
+#ifdef CONFIG_WORKQUEUE_WORK_STEALING
+	/* Worker threads, if started with k_work_queue_start_workers().
+	 * The thread, pending list and notify queue above are unused
+	 * then.
+	 */
+	struct k_work_q_worker *workers;
+
+	/* Number of entries in workers. */
+	size_t num_workers;
+#endif /* CONFIG_WORKQUEUE_WORK_STEALING */
 };
 
 /* Provide the implementation for inline functions declared above */
@@ -4078,6 +4334,12 @@ static inline k_ticks_t k_work_delayable_remaining_get(
 
 static inline k_tid_t k_work_queue_thread_get(struct k_work_q *queue)
 {
+#ifdef CONFIG_WORKQUEUE_WORK_STEALING
+	if (queue->workers != NULL) {
+		return &queue->workers[0].thread;
+	}
+#endif /* CONFIG_WORKQUEUE_WORK_STEALING */
+
 	return &queue->thread;
 }
 
@@ -4437,6 +4699,8 @@ struct k_msgq {
 	char *write_ptr;
 	/** Number of used messages */
 	uint32_t used_msgs;
+	/** Slot reserved by k_msgq_alloc_put() */
+	char *reserved_ptr;
 
 	Z_DECL_POLL_EVENT
 
@@ -4473,6 +4737,8 @@ struct k_msgq {
 
 
 #define K_MSGQ_FLAG_ALLOC	BIT(0)
+#define K_MSGQ_FLAG_PUT_RESERVED	BIT(1)
+#define K_MSGQ_FLAG_GET_PEEKED	BIT(2)
 
 /**
  * @brief Message Queue Attributes
@@ -4641,6 +4907,104 @@ __syscall int k_msgq_peek(struct k_msgq *msgq, void *data);
  */
 __syscall int k_msgq_peek_at(struct k_msgq *msgq, void *data, uint32_t idx);
 
+/**
+ * @brief Reserve a slot of a message queue to write a message in place.
+ *
+ * This routine reserves the next free slot of message queue @a msgq and
+ * returns its address in @a data, so that the message can be written
+ * directly into the queue's ring buffer instead of being copied in by
+ * k_msgq_put().  The message is sent once written by calling
+ * k_msgq_commit().
+ *
+ * The reserved slot takes its place in the queue order and counts
+ * against its capacity.  Only one slot can be reserved at a time: while a
+ * reservation is pending, other calls to k_msgq_alloc_put() return -EBUSY.
+ * Calls to k_msgq_put() still queue their messages in the free slots, but
+ * they are received after the reserved one, once it is committed.  This
+ * suits queues with a single zero-copy producer, the consumers being free
+ * to use either k_msgq_get() or k_msgq_peek_get().
+ *
+ * @note A user mode thread must have write access to the ring buffer.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Address of a pointer set to the reserved slot.
+ * @param timeout Waiting period for a slot to be free, or one of the
+ *                special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Slot reserved.
+ * @retval -EBUSY Another slot is already reserved.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_msgq_alloc_put(struct k_msgq *msgq, void **data,
+			       k_timeout_t timeout);
+
+/**
+ * @brief Send the message written in a reserved slot.
+ *
+ * This routine sends the message written in the slot obtained from
+ * k_msgq_alloc_put(), exactly as k_msgq_put() would: it is given to a
+ * waiting thread or queued, signaling K_POLL_TYPE_MSGQ_DATA_AVAILABLE
+ * events.  The slot must not be accessed afterwards.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ *
+ * @retval 0 Message sent.
+ * @retval -EINVAL No slot is reserved.
+ */
+__syscall int k_msgq_commit(struct k_msgq *msgq);
+
+/**
+ * @brief Get a message from a message queue in place.
+ *
+ * This routine returns in @a data the address of the first message of
+ * message queue @a msgq, inside the queue's ring buffer, instead of
+ * copying it out as k_msgq_get() does.  The message stays in the queue
+ * and its slot can't be reused until k_msgq_release() is called.
+ *
+ * Only one message can be held at a time: until it is released, other
+ * calls to k_msgq_peek_get() return -EBUSY, calls to k_msgq_get() wait
+ * for it to be released and K_POLL_TYPE_MSGQ_DATA_AVAILABLE events are
+ * not signaled.  This suits queues with a single zero-copy consumer, the
+ * producers being free to use either k_msgq_put() or k_msgq_alloc_put().
+ *
+ * @note A user mode thread must have read access to the ring buffer.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Address of a pointer set to the message.
+ * @param timeout Waiting period to receive the message, or one of the
+ *                special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Message received.
+ * @retval -EBUSY Another message is already held.
+ * @retval -ENOMSG Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_msgq_peek_get(struct k_msgq *msgq, void **data,
+			      k_timeout_t timeout);
+
+/**
+ * @brief Release a message obtained with k_msgq_peek_get().
+ *
+ * This routine removes the message held since k_msgq_peek_get() from the
+ * queue, making its slot available to producers.  The message must not
+ * be accessed afterwards.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ *
+ * @retval 0 Message released.
+ * @retval -EINVAL No message is held, or the queue was purged since.
+ */
+__syscall int k_msgq_release(struct k_msgq *msgq);
+
 /**
  * @brief Purge a message queue.
  *
@@ -4678,7 +5042,9 @@ __syscall void  k_msgq_get_attrs(struct k_msgq *msgq,
 
 static inline uint32_t z_impl_k_msgq_num_free_get(struct k_msgq *msgq)
 {
-	return msgq->max_msgs - msgq->used_msgs;
+	uint32_t reserved = ((msgq->flags & K_MSGQ_FLAG_PUT_RESERVED) != 0U) ? 1U : 0U;
+
+	return msgq->max_msgs - msgq->used_msgs - reserved;
 }
 
 /**
@@ -5072,11 +5438,28 @@ __syscall void k_pipe_buffer_flush(struct k_pipe *pipe);
 struct k_mem_slab_info {
 	uint32_t num_blocks;
 	size_t   block_size;
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	/* Updated outside of the slab lock by the per-CPU caches */
+	atomic_t num_used;
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	atomic_t max_used;
+#endif
+#else
 	uint32_t num_used;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	uint32_t max_used;
 #endif
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+};
+
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+/* Per-CPU stash of free blocks, linked through their first word */
+struct z_mem_slab_cpu_cache {
+	struct k_spinlock lock;
+	char *free_list;
+	uint32_t count;
 };
+#endif
 
 struct k_mem_slab {
 	_wait_q_t wait_q;
@@ -5084,6 +5467,11 @@ struct k_mem_slab {
 	char *buffer;
 	char *free_list;
 	struct k_mem_slab_info info;
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	struct z_mem_slab_cpu_cache cpu_cache[CONFIG_MP_MAX_NUM_CPUS];
+	/* Allocators short of blocks, which frees must not bypass */
+	atomic_t reclaiming;
+#endif
 
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mem_slab)
 
@@ -5310,12 +5698,33 @@ int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab);
  * @{
  */
 
+#ifdef CONFIG_HEAP_PER_CPU_CACHE
+/* Size classes of the per-CPU caches, 16 bytes apart */
+#define Z_HEAP_CACHE_CLASS_BYTES 16
+#define Z_HEAP_CACHE_CLASSES \
+	DIV_ROUND_UP(CONFIG_HEAP_PER_CPU_CACHE_MAX_SIZE, Z_HEAP_CACHE_CLASS_BYTES)
+
+/* Per-CPU cache of freed blocks, one LIFO list per size class linked
+ * through the first word of each block.
+ */
+struct z_heap_cpu_cache {
+	struct k_spinlock lock;
+	void *free[Z_HEAP_CACHE_CLASSES];
+	uint8_t count[Z_HEAP_CACHE_CLASSES];
+};
+#endif
+
 /* kernel synchronized heap struct */
 
 struct k_heap {
 	struct sys_heap heap;
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
+#ifdef CONFIG_HEAP_PER_CPU_CACHE
+	struct z_heap_cpu_cache cpu_cache[CONFIG_MP_MAX_NUM_CPUS];
+	/* Allocations that may wait for memory */
+	atomic_t cache_waiters;
+#endif
 };
 
 /**
@@ -5396,7 +5805,12 @@ void k_heap_free(struct k_heap *h, void *mem) __attribute_nonnull(1);
 /* Hand-calculated minimum heap sizes needed to return a successful
  * 1-byte allocation.  See details in lib/os/heap.[ch]
  */
+#ifdef CONFIG_SYS_HEAP_SLABS
+#define Z_HEAP_MIN_SIZE (((sizeof(void *) > 4) ? 56 : 44) + \
+			 SYS_HEAP_SLAB_CLASSES * 8)
+#else
 #define Z_HEAP_MIN_SIZE ((sizeof(void *) > 4) ? 56 : 44)
+#endif
 
 /**
  * @brief Define a static k_heap in the specified linker section
@@ -5723,6 +6137,22 @@ struct k_poll_event {
 	}, \
 	}
 
+/**
+ * @brief Poll Set
+ *
+ * A persistent set of poll events, see k_poll_set_init().
+ */
+struct k_poll_set {
+	/** PRIVATE - DO NOT TOUCH */
+	struct z_poller poller;
+
+	/** PRIVATE - DO NOT TOUCH */
+	sys_dlist_t ready;
+
+	/** PRIVATE - DO NOT TOUCH */
+	_wait_q_t wait_q;
+};
+
 /**
  * @brief Initialize one struct k_poll_event instance
  *
@@ -5843,6 +6273,79 @@ __syscall void k_poll_signal_check(struct k_poll_signal *sig,
 
 __syscall int k_poll_signal_raise(struct k_poll_signal *sig, int result);
 
+/**
+ * @brief Initialize a poll set.
+ *
+ * A poll set is a persistent alternative to k_poll() for threads waiting
+ * on many objects.  Events are registered once with k_poll_set_add() and
+ * stay registered on their objects across waits, so each object
+ * notification queues its event on the set's ready list in constant time
+ * and k_poll_set_wait() only looks at the events that were notified,
+ * whatever the number of events in the set.
+ *
+ * Readiness is level-triggered: an event returned by k_poll_set_wait() is
+ * returned again by the next wait if its condition still holds then, e.g.
+ * if the semaphore was not taken or the queue was not emptied.
+ *
+ * Poll sets can only be used from supervisor mode.
+ *
+ * @param set The poll set to initialize.
+ */
+void k_poll_set_init(struct k_poll_set *set);
+
+/**
+ * @brief Add an event to a poll set.
+ *
+ * The event must have been initialized with k_poll_event_init() or one of
+ * the static initializers, and must not be passed to k_poll() or added to
+ * another poll set while it is part of this one.  Its memory must stay
+ * valid until it is removed with k_poll_set_remove().
+ *
+ * @param set The poll set.
+ * @param event The event to add.
+ *
+ * @retval 0 The event was added.
+ * @retval -EBUSY The event is already in use by a poller.
+ */
+int k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Remove an event from a poll set.
+ *
+ * @param set The poll set.
+ * @param event The event to remove.
+ *
+ * @retval 0 The event was removed.
+ * @retval -EINVAL The event is not part of @a set.
+ */
+int k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Wait for events of a poll set to be ready.
+ *
+ * Stores pointers to up to @a max ready events in @a ready.  The state
+ * field of each returned event is set as for k_poll(), and is only valid
+ * until the next call to k_poll_set_wait() on the same set.  Events which
+ * were notified but whose condition no longer holds, because another
+ * thread consumed the object in the meantime, are not returned.
+ *
+ * Several threads may wait on the same set, each notification wakes one
+ * of them.
+ *
+ * @param set The poll set.
+ * @param ready Array receiving the ready events.
+ * @param max Size of the @a ready array.
+ * @param timeout Waiting period for an event to be ready,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return The number of ready events stored in @a ready.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EINTR Waiting has been interrupted, e.g. with
+ *         k_queue_cancel_wait() on a queue of the set.
+ */
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **ready,
+		    int max, k_timeout_t timeout);
+
 /** @} */
 
 /**
@@ -56,7 +56,19 @@ struct k_mem_paging_stats_t {
 
 		/** Number of dirty pages selected for eviction */
 		unsigned long			dirty;
+
+#if defined(CONFIG_DEMAND_PAGING_ASYNC_EVICTION) || defined(__DOXYGEN__)
+		/** Number of pages evicted ahead of time by the background thread */
+		unsigned long			async;
+#endif /* CONFIG_DEMAND_PAGING_ASYNC_EVICTION */
 	} eviction;
+
+#if defined(CONFIG_DEMAND_PAGING_READ_AHEAD) || defined(__DOXYGEN__)
+	struct {
+		/** Number of pages paged in ahead of a page fault */
+		unsigned long			pages;
+	} read_ahead;
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 };
 
@@ -327,6 +339,31 @@ void k_mem_paging_backing_store_page_out(uintptr_t location);
  */
 void k_mem_paging_backing_store_page_in(uintptr_t location);
 
+/**
+ * Copy a batch of data pages from the provided locations to page frames
+ *
+ * This is used to read ahead the data pages following a page fault, if
+ * CONFIG_DEMAND_PAGING_READ_AHEAD is enabled, and must be implemented in
+ * that case. Unlike for k_mem_paging_backing_store_page_in(), no scratch
+ * mapping is set up beforehand: the implementation either maps each
+ * destination page frame in turn with arch_mem_scratch(), or transfers
+ * all data pages at once to the physical addresses of the page frames.
+ *
+ * Calls to this, k_mem_paging_backing_store_page_in() and
+ * k_mem_paging_backing_store_page_out() will always be serialized, but
+ * interrupts may be enabled.
+ *
+ * k_mem_paging_backing_store_page_finalize() is invoked for each data page
+ * afterwards.
+ *
+ * @param pfs Destination page frames
+ * @param locations Location tokens for the data pages
+ * @param count Number of data pages to copy
+ */
+void k_mem_paging_backing_store_page_in_batch(struct z_page_frame **pfs,
+					      uintptr_t *locations,
+					      size_t count);
+
 /**
  * Update internal accounting after a page-in
  *
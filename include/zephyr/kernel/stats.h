@@ -30,4 +30,19 @@ struct k_cycle_stats {
 	bool      track_usage;  /**< true if gathering usage stats */
 };
 
+#if defined(CONFIG_SCHED_LATENCY_STATS) || defined(__DOXYGEN__)
+/**
+ * Scheduling latency histograms of a thread or CPU, in cycles of the
+ * runtime statistics clock.  Bucket 0 counts zero latencies and bucket
+ * i counts latencies in [2^(i-1), 2^i), the last bucket also counting
+ * everything larger.
+ */
+struct k_sched_latency_stats {
+	/** Time from being woken up to running */
+	uint32_t  wakeup[CONFIG_SCHED_LATENCY_STATS_BUCKETS];
+	/** Time from being switched out while runnable to running again */
+	uint32_t  preempt[CONFIG_SCHED_LATENCY_STATS_BUCKETS];
+};
+#endif /* CONFIG_SCHED_LATENCY_STATS */
+
 #endif /* ZEPHYR_INCLUDE_KERNEL_STATS_H_ */
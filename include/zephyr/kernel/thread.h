@@ -54,6 +54,35 @@ struct _pipe_desc {
 	struct k_thread *thread;         /* Back pointer to pended thread */
 };
 
+#ifdef CONFIG_SCHED_DEADLINE_PERIODIC
+/* Periodic reservation of a thread, see k_thread_period_set() */
+struct _thread_period {
+	/* Parameters in k_cycle_get_32() units, period is 0 if none */
+	uint32_t period;
+	uint32_t budget;
+	uint32_t deadline;
+
+	/* Admitted utilization, in 1/65536 of a CPU */
+	uint32_t util;
+
+	/* Start of the current period */
+	uint32_t release;
+
+	/* Budget left in the current period */
+	int32_t remaining;
+
+	/* True once out of budget, until the next period */
+	bool throttled;
+
+	/* Replenishes a throttled thread at its next period */
+	struct _timeout timeout;
+
+	uint32_t jobs;
+	uint32_t misses;
+	uint32_t overruns;
+};
+#endif /* CONFIG_SCHED_DEADLINE_PERIODIC */
+
 /* can be used for creating 'dummy' threads, e.g. for pending on objects */
 struct _thread_base {
 
@@ -105,6 +134,10 @@ struct _thread_base {
 	int prio_deadline;
 #endif /* CONFIG_SCHED_DEADLINE */
 
+#ifdef CONFIG_SCHED_DEADLINE_PERIODIC
+	struct _thread_period period;
+#endif /* CONFIG_SCHED_DEADLINE_PERIODIC */
+
 	uint32_t order_key;
 
 #ifdef CONFIG_SMP
@@ -145,6 +178,16 @@ struct _thread_base {
 #ifdef CONFIG_SCHED_THREAD_USAGE
 	struct k_cycle_stats  usage;   /* Track thread usage statistics */
 #endif /* CONFIG_SCHED_THREAD_USAGE */
+
+#ifdef CONFIG_SCHED_LATENCY_STATS
+	/* Time the thread was made ready, 0 if it is running or waiting */
+	uint32_t ready_stamp;
+
+	/* True if it was made ready by being switched out while runnable */
+	bool ready_preempted;
+
+	struct k_sched_latency_stats latency;
+#endif /* CONFIG_SCHED_LATENCY_STATS */
 };
 
 typedef struct _thread_base _thread_base_t;
@@ -194,6 +237,21 @@ struct _mem_domain_info {
 	struct k_mem_domain *mem_domain;
 };
 
+#ifdef CONFIG_OBJ_VALIDATION_CACHE
+struct k_object;
+
+struct _obj_validation_cache {
+	/** Invalidation generation the entries are valid for */
+	uint32_t gen;
+	struct {
+		/** Kernel object address */
+		const void *obj;
+		/** Its metadata, on which the thread has permission */
+		struct k_object *ko;
+	} entries[CONFIG_OBJ_VALIDATION_CACHE_SIZE];
+};
+#endif /* CONFIG_OBJ_VALIDATION_CACHE */
+
 #endif /* CONFIG_USERSPACE */
 
 #ifdef CONFIG_THREAD_USERSPACE_LOCAL_DATA
@@ -237,6 +295,33 @@ typedef struct k_thread_runtime_stats {
 	uint64_t idle_cycles;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
+#ifdef CONFIG_SCHED_IPI_STATS
+	/*
+	 * Like idle_cycles, this field is always zero for individual
+	 * threads. For CPUs, it is the number of scheduler IPIs handled.
+	 */
+
+	uint64_t ipi_count;
+#endif /* CONFIG_SCHED_IPI_STATS */
+
+#ifdef CONFIG_SCHED_LATENCY_STATS
+	/*
+	 * Scheduling latency histograms. For CPUs, they cover all the
+	 * threads switched in on the CPU.
+	 */
+
+	struct k_sched_latency_stats latency;
+
+	/*
+	 * This field is always zero for individual threads. For CPUs, it
+	 * is a histogram of the number of threads waiting in the run queue,
+	 * sampled each time a thread is switched in, with the same log2
+	 * buckets as the latency histograms.
+	 */
+
+	uint32_t runq_depth[CONFIG_SCHED_LATENCY_STATS_BUCKETS];
+#endif /* CONFIG_SCHED_LATENCY_STATS */
+
 #if defined(__cplusplus) && !defined(CONFIG_SCHED_THREAD_USAGE) &&                                 \
 	!defined(CONFIG_SCHED_THREAD_USAGE_ANALYSIS) && !defined(CONFIG_SCHED_THREAD_USAGE_ALL)
 	/* If none of the above Kconfig values are defined, this struct will have a size 0 in C
@@ -331,6 +416,11 @@ struct k_thread {
 
 	/** current syscall frame pointer */
 	void *syscall_frame;
+
+#ifdef CONFIG_OBJ_VALIDATION_CACHE
+	/** kernel objects recently validated for this thread */
+	struct _obj_validation_cache obj_cache;
+#endif /* CONFIG_OBJ_VALIDATION_CACHE */
 #endif /* CONFIG_USERSPACE */
 
 
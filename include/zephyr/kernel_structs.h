@@ -118,10 +118,17 @@ struct _priq_rb {
  * comparatively high, but performance is very fast.  Won't work with
  * features like deadline scheduling which need large priority spaces
  * to represent their requirements.
+ *
+ * With more priorities than fit in one word, a summary word marks the
+ * non-empty words of the bitmask so that finding the best priority
+ * stays two find-first-set operations regardless of the count.
  */
 struct _priq_mq {
 	sys_dlist_t queues[K_NUM_THREAD_PRIO];
 	unsigned long bitmask[PRIQ_BITMAP_SIZE];
+#if PRIQ_BITMAP_SIZE > 1
+	unsigned long summary;
+#endif
 };
 
 struct _ready_q {
@@ -137,6 +144,11 @@ struct _ready_q {
 #elif defined(CONFIG_SCHED_MULTIQ)
 	struct _priq_mq runq;
 #endif
+
+#ifdef CONFIG_SCHED_LATENCY_STATS
+	/* number of threads in runq */
+	uint32_t num_queued;
+#endif
 };
 
 typedef struct _ready_q _ready_q_t;
@@ -189,6 +201,22 @@ struct _cpu {
 #endif
 #endif
 
+#ifdef CONFIG_SCHED_IPI_STATS
+	/* Number of scheduler IPIs handled by this CPU */
+	uint64_t ipi_count;
+#endif
+
+#ifdef CONFIG_SCHED_LATENCY_STATS
+	/* Latencies of the threads switched in on this CPU */
+	struct k_sched_latency_stats latency;
+
+	/* Run queue depth histogram, sampled at each switch */
+	uint32_t runq_depth[CONFIG_SCHED_LATENCY_STATS_BUCKETS];
+
+	/* Thread switched out last */
+	struct k_thread *latency_prev;
+#endif
+
 #ifdef CONFIG_OBJ_CORE_SYSTEM
 	struct k_obj_core  obj_core;
 #endif
@@ -240,8 +268,10 @@ struct z_kernel {
 #endif
 
 #if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
-	/* Need to signal an IPI at the next scheduling point */
-	bool pending_ipi;
+	/* Bitmap of CPUs that need to be signaled an IPI at the next
+	 * scheduling point
+	 */
+	atomic_t pending_ipi;
 #endif
 };
 
@@ -302,6 +332,10 @@ struct _timeout {
 #else
 	int32_t dticks;
 #endif
+#ifdef CONFIG_TIMEOUT_SLACK
+	/* Ticks by which the timeout may expire late */
+	uint32_t slack;
+#endif /* CONFIG_TIMEOUT_SLACK */
 };
 
 typedef void (*k_thread_timeslice_fn_t)(struct k_thread *thread, void *data);
@@ -1194,6 +1194,8 @@ struct ifreq {
 #define TCP_KEEPINTVL 3
 /** Number of keepalives before dropping connection */
 #define TCP_KEEPCNT 4
+/** Congestion control algorithm, given by name ("reno", "cubic", "bbr") */
+#define TCP_CONGESTION 5
 
 /** @} */
 
@@ -59,6 +59,14 @@ struct sys_heap {
 	size_t init_bytes;
 };
 
+#ifdef CONFIG_SYS_HEAP_SLABS
+/* Number of slab front end size classes.  Classes are 16 bytes apart
+ * and must fit CONFIG_SYS_HEAP_SLAB_MAX_SIZE plus the largest (8 byte)
+ * chunk header.
+ */
+#define SYS_HEAP_SLAB_CLASSES ((CONFIG_SYS_HEAP_SLAB_MAX_SIZE + 8 + 15) / 16)
+#endif
+
 struct z_heap_stress_result {
 	uint32_t total_allocs;
 	uint32_t successful_allocs;
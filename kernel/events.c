@@ -155,20 +155,20 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 	 * 1. Walk the waitq and create a linked list of threads to unpend.
 	 * 2. Unpend each of the threads in the linked list
 	 * 3. Ready each of the threads in the linked list
+	 *
+	 * Steps 2 and 3 are done in a single batch, so that the scheduler
+	 * is only updated once however many threads are woken up.
 	 */
 
 	z_sched_waitq_walk(&event->wait_q, event_walk_op, &data);
 
 	if (data.head != NULL) {
-		thread = data.head;
-		struct k_thread *next;
-		do {
+		for (thread = data.head; thread != NULL;
+		     thread = thread->next_event_link) {
 			arch_thread_return_value_set(thread, 0);
 			thread->events = events;
-			next = thread->next_event_link;
-			z_sched_wake_thread(thread, false);
-			thread = next;
-		} while (thread != NULL);
+		}
+		z_sched_wake_event_list(data.head);
 	}
 
 	z_reschedule(&event->lock, key);
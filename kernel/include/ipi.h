@@ -7,13 +7,23 @@
 #ifndef ZEPHYR_KERNEL_INCLUDE_IPI_H_
 #define ZEPHYR_KERNEL_INCLUDE_IPI_H_
 
+#include <zephyr/kernel.h>
+#include <stdint.h>
+
+#define IPI_ALL_CPUS_MASK  BIT_MASK(CONFIG_MP_MAX_NUM_CPUS)
+
+#define IPI_CPU_MASK(cpu_id)   \
+	(IS_ENABLED(CONFIG_IPI_OPTIMIZE) ? BIT(cpu_id) : IPI_ALL_CPUS_MASK)
+
 /* defined in ipi.c when CONFIG_SMP=y */
 #ifdef CONFIG_SMP
-void flag_ipi(void);
+void flag_ipi(uint32_t ipi_mask);
 void signal_pending_ipi(void);
+uint32_t ipi_mask_create(struct k_thread *thread);
 #else
-#define flag_ipi() do { } while (false)
+#define flag_ipi(ipi_mask) do { ARG_UNUSED(ipi_mask); } while (false)
 #define signal_pending_ipi() do { } while (false)
+#define ipi_mask_create(thread) 0U
 #endif /* CONFIG_SMP */
 
 #endif /* ZEPHYR_KERNEL_INCLUDE_IPI_H_ */
@@ -222,6 +222,9 @@ void z_mem_manage_boot_finish(void);
 
 void z_handle_obj_poll_events(sys_dlist_t *events, uint32_t state);
 
+/* A message can be received, none being held with k_msgq_peek_get() */
+bool z_msgq_data_available(struct k_msgq *msgq);
+
 #ifdef CONFIG_PM
 
 /* When the kernel is about to go idle, it calls this function to notify the
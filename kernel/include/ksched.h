@@ -13,6 +13,7 @@
 #include <kthread.h>
 #include <zephyr/tracing/tracing.h>
 #include <stdbool.h>
+#include <limits.h>
 
 BUILD_ASSERT(K_LOWEST_APPLICATION_THREAD_PRIO
 	     >= K_HIGHEST_APPLICATION_THREAD_PRIO);
@@ -57,6 +58,7 @@ void *z_get_next_switch_handle(void *interrupted);
 
 void z_time_slice(void);
 void z_reset_time_slice(struct k_thread *curr);
+void z_reset_time_slice_cpu(int cpu, struct k_thread *curr);
 void z_sched_abort(struct k_thread *thread);
 void z_sched_ipi(void);
 void z_sched_start(struct k_thread *thread);
@@ -182,6 +184,34 @@ static inline void z_sched_lock(void)
  */
 bool z_sched_wake(_wait_q_t *wait_q, int swap_retval, void *swap_data);
 
+/**
+ * Wake up to @a n threads pending on the provided wait queue
+ *
+ * Threads are woken in priority order, as with repeated z_sched_wake()
+ * calls, but the scheduler lock is taken only once and the ready queue
+ * cache update and IPI are done once for the whole batch.
+ *
+ * @param wait_q Wait queue to wake up threads from
+ * @param n Maximum number of threads to wake up
+ * @param swap_retval Swap return value for woken threads
+ * @param swap_data Data return value to supplement swap_retval. May be NULL.
+ * @return Number of threads woken up
+ */
+unsigned int z_sched_wake_n(_wait_q_t *wait_q, unsigned int n,
+			    int swap_retval, void *swap_data);
+
+#ifdef CONFIG_EVENTS
+/**
+ * Wake a list of threads linked through next_event_link
+ *
+ * Batched equivalent of calling z_sched_wake_thread(thread, false) on
+ * each thread of the list.
+ *
+ * @param head First thread of the list
+ */
+void z_sched_wake_event_list(struct k_thread *head);
+#endif /* CONFIG_EVENTS */
+
 /**
  * Wakes the specified thread.
  *
@@ -197,8 +227,8 @@ void z_sched_wake_thread(struct k_thread *thread, bool is_timeout);
 /**
  * Wake up all threads pending on the provided wait queue
  *
- * Convenience function to invoke z_sched_wake() on all threads in the queue
- * until there are no more to wake up.
+ * Convenience function to invoke z_sched_wake_n() on all threads in the
+ * queue.
  *
  * @param wait_q Wait queue to wake up the highest prio thread
  * @param swap_retval Swap return value for woken thread
@@ -209,14 +239,8 @@ void z_sched_wake_thread(struct k_thread *thread, bool is_timeout);
 static inline bool z_sched_wake_all(_wait_q_t *wait_q, int swap_retval,
 				    void *swap_data)
 {
-	bool woken = false;
-
-	while (z_sched_wake(wait_q, swap_retval, swap_data)) {
-		woken = true;
-	}
-
 	/* True if we woke at least one thread up */
-	return woken;
+	return z_sched_wake_n(wait_q, UINT_MAX, swap_retval, swap_data) != 0U;
 }
 
 /**
@@ -295,6 +319,38 @@ void z_sched_cpu_usage(uint8_t core_id, struct k_thread_runtime_stats *stats);
 void z_sched_thread_usage(struct k_thread *thread,
 			  struct k_thread_runtime_stats *stats);
 
+#ifdef CONFIG_SCHED_LATENCY_STATS
+/**
+ * @brief Timestamps a thread made ready, for the wakeup latency histograms
+ */
+void z_sched_latency_ready(struct k_thread *thread);
+#else
+static inline void z_sched_latency_ready(struct k_thread *thread)
+{
+	ARG_UNUSED(thread);
+}
+#endif /* CONFIG_SCHED_LATENCY_STATS */
+
+#ifdef CONFIG_SCHED_DEADLINE_PERIODIC
+/* True for a thread with a periodic reservation and budget left */
+static inline bool z_sched_period_active(struct k_thread *thread)
+{
+	return (thread->base.period.period != 0U) &&
+	       !thread->base.period.throttled;
+}
+
+/**
+ * @brief Demotes a thread out of budget until its next period
+ */
+void z_sched_period_throttle(struct k_thread *thread);
+#else
+static inline bool z_sched_period_active(struct k_thread *thread)
+{
+	ARG_UNUSED(thread);
+	return false;
+}
+#endif /* CONFIG_SCHED_DEADLINE_PERIODIC */
+
 static inline void z_sched_usage_switch(struct k_thread *thread)
 {
 	ARG_UNUSED(thread);
@@ -116,26 +116,40 @@ static ALWAYS_INLINE struct k_thread *z_priq_rb_best(struct _priq_rb *pq)
 	return thread;
 }
 
+BUILD_ASSERT(PRIQ_BITMAP_SIZE <= BITS_PER_LONG,
+	     "multiq summary word cannot cover all priorities");
+
+static ALWAYS_INLINE unsigned int z_priq_mq_ctz(unsigned long word)
+{
+#ifdef CONFIG_64BIT
+	return u64_count_trailing_zeros(word);
+#else
+	return u32_count_trailing_zeros(word);
+#endif /* CONFIG_64BIT */
+}
+
 static ALWAYS_INLINE struct k_thread *z_priq_mq_best(struct _priq_mq *pq)
 {
 	struct k_thread *thread = NULL;
+	unsigned int i;
 
-	for (int i = 0; i < PRIQ_BITMAP_SIZE; ++i) {
-		if (!pq->bitmask[i]) {
-			continue;
-		}
-
-#ifdef CONFIG_64BIT
-		sys_dlist_t *l = &pq->queues[i * 64 + u64_count_trailing_zeros(pq->bitmask[i])];
+#if PRIQ_BITMAP_SIZE > 1
+	if (pq->summary == 0) {
+		return NULL;
+	}
+	i = z_priq_mq_ctz(pq->summary);
 #else
-		sys_dlist_t *l = &pq->queues[i * 32 + u32_count_trailing_zeros(pq->bitmask[i])];
-#endif
-		sys_dnode_t *n = sys_dlist_peek_head(l);
+	if (pq->bitmask[0] == 0) {
+		return NULL;
+	}
+	i = 0;
+#endif /* PRIQ_BITMAP_SIZE > 1 */
 
-		if (n != NULL) {
-			thread = CONTAINER_OF(n, struct k_thread, base.qnode_dlist);
-			break;
-		}
+	sys_dlist_t *l = &pq->queues[i * BITS_PER_LONG + z_priq_mq_ctz(pq->bitmask[i])];
+	sys_dnode_t *n = sys_dlist_peek_head(l);
+
+	if (n != NULL) {
+		thread = CONTAINER_OF(n, struct k_thread, base.qnode_dlist);
 	}
 
 	return thread;
@@ -168,6 +182,9 @@ static ALWAYS_INLINE void z_priq_mq_add(struct _priq_mq *pq,
 
 	sys_dlist_append(&pq->queues[pos.offset_prio], &thread->base.qnode_dlist);
 	pq->bitmask[pos.idx] |= BIT(pos.bit);
+#if PRIQ_BITMAP_SIZE > 1
+	pq->summary |= BIT(pos.idx);
+#endif /* PRIQ_BITMAP_SIZE > 1 */
 }
 
 static ALWAYS_INLINE void z_priq_mq_remove(struct _priq_mq *pq,
@@ -178,6 +195,11 @@ static ALWAYS_INLINE void z_priq_mq_remove(struct _priq_mq *pq,
 	sys_dlist_remove(&thread->base.qnode_dlist);
 	if (sys_dlist_is_empty(&pq->queues[pos.offset_prio])) {
 		pq->bitmask[pos.idx] &= ~BIT(pos.bit);
+#if PRIQ_BITMAP_SIZE > 1
+		if (pq->bitmask[pos.idx] == 0) {
+			pq->summary &= ~BIT(pos.idx);
+		}
+#endif /* PRIQ_BITMAP_SIZE > 1 */
 	}
 }
 #endif /* CONFIG_SCHED_MULTIQ */
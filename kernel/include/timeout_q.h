@@ -25,6 +25,24 @@ extern "C" {
 static inline void z_init_timeout(struct _timeout *to)
 {
 	sys_dnode_init(&to->node);
+#ifdef CONFIG_TIMEOUT_SLACK
+	to->slack = 0U;
+#endif /* CONFIG_TIMEOUT_SLACK */
+}
+
+static inline void z_set_timeout_slack(struct _timeout *to, k_timeout_t slack)
+{
+#ifdef CONFIG_TIMEOUT_SLACK
+	/* Covers K_FOREVER and absolute timeouts too */
+	if (slack.ticks <= 0) {
+		to->slack = 0U;
+	} else {
+		to->slack = (uint32_t)MIN((uint64_t)slack.ticks, UINT32_MAX);
+	}
+#else
+	ARG_UNUSED(to);
+	ARG_UNUSED(slack);
+#endif /* CONFIG_TIMEOUT_SLACK */
 }
 
 void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
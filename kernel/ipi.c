@@ -13,15 +13,55 @@ extern void z_trace_sched_ipi(void);
 #endif
 
 
-void flag_ipi(void)
+void flag_ipi(uint32_t ipi_mask)
 {
 #if defined(CONFIG_SCHED_IPI_SUPPORTED)
-	if (arch_num_cpus() > 1) {
-		_kernel.pending_ipi = true;
+	if ((arch_num_cpus() > 1) && (ipi_mask != 0U)) {
+		atomic_or(&_kernel.pending_ipi, (atomic_val_t)ipi_mask);
 	}
 #endif /* CONFIG_SCHED_IPI_SUPPORTED */
 }
 
+/* Must be called with _sched_spinlock held */
+uint32_t ipi_mask_create(struct k_thread *thread)
+{
+	if (!IS_ENABLED(CONFIG_IPI_OPTIMIZE)) {
+		return (CONFIG_MP_MAX_NUM_CPUS > 1) ? IPI_ALL_CPUS_MASK : 0;
+	}
+
+	uint32_t ipi_mask = 0;
+	uint32_t num_cpus = (uint32_t)arch_num_cpus();
+	uint32_t id = _current_cpu->id;
+	struct k_thread *cpu_thread;
+	bool executable_on_cpu = true;
+
+	for (uint32_t i = 0; i < num_cpus; i++) {
+		if (id == i) {
+			continue;
+		}
+
+		/*
+		 * An IPI is not needed if the CPU has not started yet
+		 * or if the thread can't run there, nor if the thread
+		 * would not preempt what the CPU is currently running
+		 * (unless it is a meta-IRQ thread).
+		 */
+#if defined(CONFIG_SCHED_CPU_MASK)
+		executable_on_cpu = ((thread->base.cpu_mask & BIT(i)) != 0);
+#endif /* CONFIG_SCHED_CPU_MASK */
+
+		cpu_thread = _kernel.cpus[i].current;
+		if ((cpu_thread != NULL) && executable_on_cpu &&
+		    (((z_sched_prio_cmp(cpu_thread, thread) < 0) &&
+		      thread_is_preemptible(cpu_thread)) ||
+		     thread_is_metairq(thread))) {
+			ipi_mask |= BIT(i);
+		}
+	}
+
+	return ipi_mask;
+}
+
 
 void signal_pending_ipi(void)
 {
@@ -34,9 +74,15 @@ void signal_pending_ipi(void)
 	 */
 #if defined(CONFIG_SCHED_IPI_SUPPORTED)
 	if (arch_num_cpus() > 1) {
-		if (_kernel.pending_ipi) {
-			_kernel.pending_ipi = false;
+		uint32_t cpu_bitmap;
+
+		cpu_bitmap = (uint32_t)atomic_clear(&_kernel.pending_ipi);
+		if (cpu_bitmap != 0) {
+#ifdef CONFIG_ARCH_HAS_DIRECTED_IPIS
+			arch_sched_directed_ipi(cpu_bitmap);
+#else
 			arch_sched_ipi();
+#endif /* CONFIG_ARCH_HAS_DIRECTED_IPIS */
 		}
 	}
 #endif /* CONFIG_SCHED_IPI_SUPPORTED */
@@ -51,8 +97,12 @@ void z_sched_ipi(void)
 	z_trace_sched_ipi();
 #endif /* CONFIG_TRACE_SCHED_IPI */
 
+#ifdef CONFIG_SCHED_IPI_STATS
+	_current_cpu->ipi_count++;
+#endif /* CONFIG_SCHED_IPI_STATS */
+
 #ifdef CONFIG_TIMESLICING
-	if (thread_is_sliceable(_current)) {
+	if (thread_is_sliceable(_current) || z_sched_period_active(_current)) {
 		z_time_slice();
 	}
 #endif /* CONFIG_TIMESLICING */
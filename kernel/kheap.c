@@ -8,6 +8,7 @@
 #include <zephyr/init.h>
 #include <zephyr/linker/linker-defs.h>
 #include <zephyr/sys/iterable_sections.h>
+#include <string.h>
 /* private kernel APIs */
 #include <ksched.h>
 #include <wait_q.h>
@@ -16,6 +17,10 @@ void k_heap_init(struct k_heap *heap, void *mem, size_t bytes)
 {
 	z_waitq_init(&heap->wait_q);
 	sys_heap_init(&heap->heap, mem, bytes);
+#ifdef CONFIG_HEAP_PER_CPU_CACHE
+	(void)memset(heap->cpu_cache, 0, sizeof(heap->cpu_cache));
+	atomic_clear(&heap->cache_waiters);
+#endif
 
 	SYS_PORT_TRACING_OBJ_INIT(k_heap, heap);
 }
@@ -62,12 +67,130 @@ SYS_INIT_NAMED(statics_init_pre, statics_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_
 SYS_INIT_NAMED(statics_init_post, statics_init, POST_KERNEL, 0);
 #endif /* CONFIG_DEMAND_PAGING && !CONFIG_LINKER_GENERIC_SECTIONS_PRESENT_AT_BOOT */
 
+#ifdef CONFIG_HEAP_PER_CPU_CACHE
+/* The cache of the current CPU.  Callers may migrate to another CPU
+ * after this, which costs some locality but is otherwise harmless as
+ * every cache has its own lock.
+ */
+static struct z_heap_cpu_cache *cpu_cache(struct k_heap *heap)
+{
+	return &heap->cpu_cache[arch_curr_cpu()->id];
+}
+
+static void *cache_alloc(struct k_heap *heap, int cls)
+{
+	struct z_heap_cpu_cache *cache = cpu_cache(heap);
+	k_spinlock_key_t key = k_spin_lock(&cache->lock);
+	void *mem = cache->free[cls];
+
+	if (mem != NULL) {
+		cache->free[cls] = *(void **)mem;
+		cache->count[cls]--;
+	}
+
+	k_spin_unlock(&cache->lock, key);
+
+	return mem;
+}
+
+/* Returns all cached blocks to the heap, with the heap lock held */
+static void cache_drain(struct k_heap *heap)
+{
+	for (int i = 0; i < ARRAY_SIZE(heap->cpu_cache); i++) {
+		struct z_heap_cpu_cache *cache = &heap->cpu_cache[i];
+		k_spinlock_key_t key = k_spin_lock(&cache->lock);
+
+		for (int cls = 0; cls < Z_HEAP_CACHE_CLASSES; cls++) {
+			while (cache->free[cls] != NULL) {
+				void *mem = cache->free[cls];
+
+				cache->free[cls] = *(void **)mem;
+				sys_heap_free(&heap->heap, mem);
+			}
+			cache->count[cls] = 0;
+		}
+
+		k_spin_unlock(&cache->lock, key);
+	}
+}
+
+static bool cache_free(struct k_heap *heap, void *mem)
+{
+	/* Reading the size of a block we own needs no heap lock: chunk
+	 * headers only change when their own chunk is freed.
+	 */
+	size_t bytes = sys_heap_usable_size(&heap->heap, mem);
+	int cls = (int)(bytes / Z_HEAP_CACHE_CLASS_BYTES) - 1;
+	struct z_heap_cpu_cache *cache;
+	k_spinlock_key_t key;
+	bool cached = false;
+
+	/* Blocks go to the largest class they can serve.  Don't hold on
+	 * to memory that a waiting thread might need.
+	 */
+	if (cls < 0 || cls >= Z_HEAP_CACHE_CLASSES ||
+	    atomic_get(&heap->cache_waiters) != 0) {
+		return false;
+	}
+
+	cache = cpu_cache(heap);
+	key = k_spin_lock(&cache->lock);
+
+	if (cache->count[cls] < CONFIG_HEAP_PER_CPU_CACHE_DEPTH) {
+		*(void **)mem = cache->free[cls];
+		cache->free[cls] = mem;
+		cache->count[cls]++;
+		cached = true;
+	}
+
+	k_spin_unlock(&cache->lock, key);
+
+	/* An allocation that may wait announces itself before draining
+	 * the caches.  If it drained this one before the block got in, it
+	 * is seen here: give the block back and wake it up.
+	 */
+	if (cached && atomic_get(&heap->cache_waiters) != 0) {
+		key = k_spin_lock(&heap->lock);
+		cache_drain(heap);
+		if (IS_ENABLED(CONFIG_MULTITHREADING) &&
+		    (z_unpend_all(&heap->wait_q) != 0)) {
+			z_reschedule(&heap->lock, key);
+		} else {
+			k_spin_unlock(&heap->lock, key);
+		}
+	}
+
+	return cached;
+}
+#endif /* CONFIG_HEAP_PER_CPU_CACHE */
+
 void *k_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t bytes,
 			k_timeout_t timeout)
 {
 	k_timepoint_t end = sys_timepoint_calc(timeout);
 	void *ret = NULL;
 
+#ifdef CONFIG_HEAP_PER_CPU_CACHE
+	size_t req_bytes = bytes;
+
+	/* Small blocks with no particular alignment come from the
+	 * cache.  Otherwise round them up to their size class, so that
+	 * they get cached when freed.
+	 */
+	if (align <= sizeof(void *) && bytes != 0U &&
+	    bytes <= CONFIG_HEAP_PER_CPU_CACHE_MAX_SIZE) {
+		int cls = DIV_ROUND_UP(bytes, Z_HEAP_CACHE_CLASS_BYTES) - 1;
+
+		ret = cache_alloc(heap, cls);
+		if (ret != NULL) {
+			SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap, aligned_alloc, heap, timeout);
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, aligned_alloc, heap, timeout, ret);
+			return ret;
+		}
+		bytes = (cls + 1) * Z_HEAP_CACHE_CLASS_BYTES;
+	}
+#endif
+
 	k_spinlock_key_t key = k_spin_lock(&heap->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap, aligned_alloc, heap, timeout);
@@ -76,9 +199,30 @@ void *k_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t bytes,
 
 	bool blocked_alloc = false;
 
+#ifdef CONFIG_HEAP_PER_CPU_CACHE
+	bool may_wait = IS_ENABLED(CONFIG_MULTITHREADING) &&
+			!K_TIMEOUT_EQ(timeout, K_NO_WAIT);
+
+	/* Make frees bypass or flush the caches until we are done */
+	if (may_wait) {
+		atomic_inc(&heap->cache_waiters);
+	}
+#endif
+
 	while (ret == NULL) {
 		ret = sys_heap_aligned_alloc(&heap->heap, align, bytes);
 
+#ifdef CONFIG_HEAP_PER_CPU_CACHE
+		/* Under memory pressure, give back what the caches hold
+		 * and retry without rounding up.
+		 */
+		if (ret == NULL) {
+			cache_drain(heap);
+			bytes = req_bytes;
+			ret = sys_heap_aligned_alloc(&heap->heap, align, bytes);
+		}
+#endif
+
 		if (!IS_ENABLED(CONFIG_MULTITHREADING) ||
 		    (ret != NULL) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
 			break;
@@ -99,6 +243,12 @@ void *k_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t bytes,
 		key = k_spin_lock(&heap->lock);
 	}
 
+#ifdef CONFIG_HEAP_PER_CPU_CACHE
+	if (may_wait) {
+		atomic_dec(&heap->cache_waiters);
+	}
+#endif
+
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, aligned_alloc, heap, timeout, ret);
 
 	k_spin_unlock(&heap->lock, key);
@@ -118,6 +268,13 @@ void *k_heap_alloc(struct k_heap *heap, size_t bytes, k_timeout_t timeout)
 
 void k_heap_free(struct k_heap *heap, void *mem)
 {
+#ifdef CONFIG_HEAP_PER_CPU_CACHE
+	if (mem != NULL && cache_free(heap, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC(k_heap, free, heap);
+		return;
+	}
+#endif
+
 	k_spinlock_key_t key = k_spin_lock(&heap->lock);
 
 	sys_heap_free(&heap->heap, mem);
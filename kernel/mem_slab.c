@@ -183,6 +183,10 @@ int k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	slab->info.max_used = 0U;
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	(void)memset(slab->cpu_cache, 0, sizeof(slab->cpu_cache));
+	atomic_clear(&slab->reclaiming);
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
 
 	rc = create_free_list(slab);
 	if (rc < 0) {
@@ -205,23 +209,286 @@ out:
 	return rc;
 }
 
-int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
+static inline void slab_used_inc(struct k_mem_slab *slab)
+{
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	atomic_val_t used = atomic_inc(&slab->info.num_used) + 1;
+
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	atomic_val_t max_used;
+
+	do {
+		max_used = atomic_get(&slab->info.max_used);
+		if (used <= max_used) {
+			break;
+		}
+	} while (!atomic_cas(&slab->info.max_used, max_used, used));
+#else
+	ARG_UNUSED(used);
+#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+#else
+	slab->info.num_used++;
+
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	slab->info.max_used = MAX(slab->info.num_used,
+				  slab->info.max_used);
+#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+}
+
+static inline void slab_used_dec(struct k_mem_slab *slab)
+{
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	(void)atomic_dec(&slab->info.num_used);
+#else
+	slab->info.num_used--;
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+}
+
+/* Returns a free block to the slab, with the slab lock held.  If
+ * threads wait for a block, it goes to the first of them instead and
+ * true is returned: the caller must then reschedule.
+ */
+static bool slab_give(struct k_mem_slab *slab, char *mem)
+{
+	if ((slab->free_list == NULL) && IS_ENABLED(CONFIG_MULTITHREADING)) {
+		struct k_thread *pending_thread = z_unpend_first_thread(&slab->wait_q);
+
+		if (pending_thread != NULL) {
+			z_thread_return_value_set_with_data(pending_thread, 0, mem);
+			z_ready_thread(pending_thread);
+			slab_used_inc(slab);
+			return true;
+		}
+	}
+	*(char **)mem = slab->free_list;
+	slab->free_list = mem;
+
+	return false;
+}
+
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+#define CACHE_DEPTH CONFIG_MEM_SLAB_PER_CPU_CACHE_DEPTH
+#define CACHE_BATCH (CONFIG_MEM_SLAB_PER_CPU_CACHE_DEPTH / 2)
+
+/* The cache of the current CPU.  Callers may migrate to another CPU
+ * after this, which costs some locality but is otherwise harmless as
+ * every cache has its own lock.
+ */
+static struct z_mem_slab_cpu_cache *cpu_cache(struct k_mem_slab *slab)
+{
+	return &slab->cpu_cache[arch_curr_cpu()->id];
+}
+
+/* Returns a NULL terminated list of blocks to the slab */
+static void slab_give_list(struct k_mem_slab *slab, char *list)
+{
+	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	bool resched = false;
+
+	/* Allocators may have started waiting in the meantime */
+	while (list != NULL) {
+		char *next = *(char **)list;
+
+		resched = slab_give(slab, list) || resched;
+		list = next;
+	}
+
+	if (resched) {
+		z_reschedule(&slab->lock, key);
+	} else {
+		k_spin_unlock(&slab->lock, key);
+	}
+}
+
+/* Takes a batch of blocks from the slab free list, keeps all but one
+ * of them in @a cache and returns that one.  The slab and cache locks
+ * are never held together here, so that cache_reclaim() can take the
+ * cache locks with the slab lock held.
+ */
+static char *cache_refill(struct k_mem_slab *slab,
+			  struct z_mem_slab_cpu_cache *cache)
 {
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	char *head = slab->free_list;
+	char *tail = NULL;
+	uint32_t n = 0U;
+
+	while ((n < CACHE_BATCH) && (slab->free_list != NULL)) {
+		tail = slab->free_list;
+		slab->free_list = *(char **)tail;
+		n++;
+	}
+
+	k_spin_unlock(&slab->lock, key);
+
+	if (n > 1U) {
+		key = k_spin_lock(&cache->lock);
+
+		/* As in cache_free(): an allocator may have reclaimed this
+		 * cache before the batch got in, and wait for a block.
+		 */
+		if (atomic_get(&slab->reclaiming) == 0) {
+			*(char **)tail = cache->free_list;
+			cache->free_list = *(char **)head;
+			cache->count += n - 1U;
+			k_spin_unlock(&cache->lock, key);
+		} else {
+			k_spin_unlock(&cache->lock, key);
+			*(char **)tail = NULL;
+			slab_give_list(slab, *(char **)head);
+		}
+	}
+
+	return head;
+}
+
+static void *cache_alloc(struct k_mem_slab *slab)
+{
+	struct z_mem_slab_cpu_cache *cache = cpu_cache(slab);
+	k_spinlock_key_t key = k_spin_lock(&cache->lock);
+	char *mem = cache->free_list;
+
+	if (mem != NULL) {
+		cache->free_list = *(char **)mem;
+		cache->count--;
+	}
+
+	k_spin_unlock(&cache->lock, key);
+
+	if (mem == NULL) {
+		mem = cache_refill(slab, cache);
+	}
+	if (mem != NULL) {
+		slab_used_inc(slab);
+	}
+
+	return mem;
+}
+
+static bool cache_free(struct k_mem_slab *slab, void *mem)
+{
+	struct z_mem_slab_cpu_cache *cache = cpu_cache(slab);
+	k_spinlock_key_t key = k_spin_lock(&cache->lock);
+	char *batch = NULL;
+
+	/* Checked under the cache lock, which cache_reclaim() takes
+	 * after raising the count: either the block is stashed before
+	 * the cache is reclaimed, or it goes to the slab.
+	 */
+	if (atomic_get(&slab->reclaiming) != 0) {
+		k_spin_unlock(&cache->lock, key);
+		return false;
+	}
+
+	if (cache->count == CACHE_DEPTH) {
+		char *tail = cache->free_list;
+
+		for (int i = 1; i < CACHE_BATCH; i++) {
+			tail = *(char **)tail;
+		}
+		batch = cache->free_list;
+		cache->free_list = *(char **)tail;
+		cache->count -= CACHE_BATCH;
+		*(char **)tail = NULL;
+	}
+
+	*(char **)mem = cache->free_list;
+	cache->free_list = mem;
+	cache->count++;
+
+	k_spin_unlock(&cache->lock, key);
+
+	slab_used_dec(slab);
+
+	if (batch != NULL) {
+		slab_give_list(slab, batch);
+	}
+
+	return true;
+}
+
+/* Moves the blocks stashed by all CPUs back to the slab free list,
+ * with the slab lock held.  If @a will_pend, frees bypass the caches
+ * from now on until cache_reclaim_done(), so that no block can end
+ * up stashed while the caller waits for one.
+ */
+static bool cache_reclaim(struct k_mem_slab *slab, bool will_pend)
+{
+	if (will_pend) {
+		(void)atomic_inc(&slab->reclaiming);
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(slab->cpu_cache); i++) {
+		struct z_mem_slab_cpu_cache *cache = &slab->cpu_cache[i];
+		k_spinlock_key_t key = k_spin_lock(&cache->lock);
+
+		while (cache->free_list != NULL) {
+			char *mem = cache->free_list;
+
+			cache->free_list = *(char **)mem;
+			*(char **)mem = slab->free_list;
+			slab->free_list = mem;
+		}
+		cache->count = 0U;
+
+		k_spin_unlock(&cache->lock, key);
+	}
+
+	return will_pend;
+}
+
+static inline void cache_reclaim_done(struct k_mem_slab *slab, bool reclaiming)
+{
+	if (reclaiming) {
+		(void)atomic_dec(&slab->reclaiming);
+	}
+}
+#else
+static inline bool cache_reclaim(struct k_mem_slab *slab, bool will_pend)
+{
+	ARG_UNUSED(slab);
+	ARG_UNUSED(will_pend);
+
+	return false;
+}
+
+static inline void cache_reclaim_done(struct k_mem_slab *slab, bool reclaiming)
+{
+	ARG_UNUSED(slab);
+	ARG_UNUSED(reclaiming);
+}
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+
+int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+	bool reclaiming = false;
 	int result;
 
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	*mem = cache_alloc(slab);
+	if (*mem != NULL) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, 0);
+		return 0;
+	}
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+
+	key = k_spin_lock(&slab->lock);
+
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
 
+	if (slab->free_list == NULL) {
+		reclaiming = cache_reclaim(slab, !K_TIMEOUT_EQ(timeout, K_NO_WAIT) &&
+					   IS_ENABLED(CONFIG_MULTITHREADING));
+	}
+
 	if (slab->free_list != NULL) {
 		/* take a free block */
 		*mem = slab->free_list;
 		slab->free_list = *(char **)(slab->free_list);
-		slab->info.num_used++;
-
-#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
-		slab->info.max_used = MAX(slab->info.num_used,
-					  slab->info.max_used);
-#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+		slab_used_inc(slab);
 
 		result = 0;
 	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT) ||
@@ -237,12 +504,15 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 		if (result == 0) {
 			*mem = _current->base.swap_data;
 		}
+		cache_reclaim_done(slab, reclaiming);
 
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
 
 		return result;
 	}
 
+	cache_reclaim_done(slab, reclaiming);
+
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
 
 	k_spin_unlock(&slab->lock, key);
@@ -252,7 +522,7 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 
 void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
 {
-	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	k_spinlock_key_t key;
 
 	__ASSERT(((char *)mem >= slab->buffer) &&
 		 ((((char *)mem - slab->buffer) % slab->info.block_size) == 0) &&
@@ -260,22 +530,25 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
 						  (slab->info.num_blocks - 1)))),
 		 "Invalid memory pointer provided");
 
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	if (cache_free(slab, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+		return;
+	}
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+
+	key = k_spin_lock(&slab->lock);
+
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
-	if ((slab->free_list == NULL) && IS_ENABLED(CONFIG_MULTITHREADING)) {
-		struct k_thread *pending_thread = z_unpend_first_thread(&slab->wait_q);
 
-		if (pending_thread != NULL) {
-			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+	slab_used_dec(slab);
+	if (slab_give(slab, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
 
-			z_thread_return_value_set_with_data(pending_thread, 0, mem);
-			z_ready_thread(pending_thread);
-			z_reschedule(&slab->lock, key);
-			return;
-		}
+		z_reschedule(&slab->lock, key);
+		return;
 	}
-	*(char **) mem = slab->free_list;
-	slab->free_list = (char *) mem;
-	slab->info.num_used--;
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
 
@@ -1115,6 +1115,44 @@ static inline void do_backing_store_page_out(uintptr_t location)
 #endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
 }
 
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+static inline void do_backing_store_page_in_batch(struct z_page_frame **pfs,
+						  uintptr_t *locations,
+						  size_t count)
+{
+#ifdef CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM
+	uint32_t time_diff;
+
+#ifdef CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS
+	timing_t time_start, time_end;
+
+	time_start = timing_counter_get();
+#else
+	uint32_t time_start;
+
+	time_start = k_cycle_get_32();
+#endif /* CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS */
+#endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
+
+	k_mem_paging_backing_store_page_in_batch(pfs, locations, count);
+
+#ifdef CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM
+#ifdef CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS
+	time_end = timing_counter_get();
+	time_diff = (uint32_t)timing_cycles_get(&time_start, &time_end);
+#else
+	time_diff = k_cycle_get_32() - time_start;
+#endif /* CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS */
+
+	/* Account the batch as that many page-ins of average duration */
+	for (size_t i = 0; i < count; i++) {
+		z_paging_histogram_inc(&z_paging_histogram_backing_store_page_in,
+				       time_diff / count);
+	}
+#endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
+}
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
+
 /* Current implementation relies on interrupt locking to any prevent page table
  * access, which falls over if other CPUs are active. Addressing this is not
  * as simple as using spinlocks as regular memory reads/writes constitute
@@ -1390,6 +1428,21 @@ static inline void paging_stats_eviction_inc(struct k_thread *faulting_thread,
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 }
 
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+static inline void paging_stats_read_ahead_inc(struct k_thread *faulting_thread,
+					       size_t count)
+{
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	paging_stats.read_ahead.pages += count;
+#ifdef CONFIG_DEMAND_PAGING_THREAD_STATS
+	faulting_thread->paging_stats.read_ahead.pages += count;
+#else
+	ARG_UNUSED(faulting_thread);
+#endif /* CONFIG_DEMAND_PAGING_THREAD_STATS */
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+}
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
+
 static inline struct z_page_frame *do_eviction_select(bool *dirty)
 {
 	struct z_page_frame *pf;
@@ -1424,6 +1477,209 @@ static inline struct z_page_frame *do_eviction_select(bool *dirty)
 	return pf;
 }
 
+#ifdef CONFIG_DEMAND_PAGING_ASYNC_EVICTION
+BUILD_ASSERT(CONFIG_DEMAND_PAGING_ASYNC_EVICTION_FREE_MAX >=
+	     CONFIG_DEMAND_PAGING_ASYNC_EVICTION_FREE_MIN,
+	     "background eviction stops before reaching its start threshold");
+
+/* Background eviction: keep a few page frames free so that page faults
+ * (and read-ahead) rarely have to evict a page frame, and wait for its
+ * page-out, before they can page in.
+ */
+static struct k_sem evictor_sem;
+static struct k_thread evictor_thread;
+static K_KERNEL_PINNED_STACK_DEFINE(evictor_stack,
+				    CONFIG_DEMAND_PAGING_ASYNC_EVICTION_STACK_SIZE);
+static bool evictor_started;
+
+/* Checked with IRQs locked, the evictor is woken up with evictor_wake()
+ * once they are unlocked: giving the semaphore may reschedule.
+ */
+static inline bool evictor_wake_needed_locked(void)
+{
+	return evictor_started &&
+	       z_free_page_count < CONFIG_DEMAND_PAGING_ASYNC_EVICTION_FREE_MIN;
+}
+
+static inline void evictor_wake(bool needed)
+{
+	if (needed) {
+		k_sem_give(&evictor_sem);
+	}
+}
+
+/* Evict one page frame to the free list. Returns false once enough page
+ * frames are free, or if the backing store is full.
+ */
+static bool do_async_evict(void)
+{
+	struct z_page_frame *pf;
+	uintptr_t location;
+	bool dirty;
+	bool ret = false;
+	int key;
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	k_sched_lock();
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	key = irq_lock();
+	if (z_free_page_count >= CONFIG_DEMAND_PAGING_ASYNC_EVICTION_FREE_MAX) {
+		goto out;
+	}
+
+	pf = do_eviction_select(&dirty);
+	__ASSERT(pf != NULL, "failed to get a page frame");
+	if (page_frame_prepare_locked(pf, &dirty, false, &location) != 0) {
+		goto out;
+	}
+	paging_stats_eviction_inc(_current_cpu->current, dirty);
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	paging_stats.eviction.async++;
+#ifdef CONFIG_DEMAND_PAGING_THREAD_STATS
+	_current_cpu->current->paging_stats.eviction.async++;
+#endif /* CONFIG_DEMAND_PAGING_THREAD_STATS */
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	irq_unlock(key);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	if (dirty) {
+		do_backing_store_page_out(location);
+	}
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	key = irq_lock();
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	page_frame_free_locked(pf);
+	ret = true;
+out:
+	irq_unlock(key);
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	k_sched_unlock();
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+
+	return ret;
+}
+
+static void evictor_thread_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		(void)k_sem_take(&evictor_sem, K_FOREVER);
+
+		while (do_async_evict()) {
+			/* Until enough page frames are free */
+		}
+	}
+}
+
+static int evictor_init(void)
+{
+	k_sem_init(&evictor_sem, 0, 1);
+	k_thread_create(&evictor_thread, evictor_stack,
+			K_KERNEL_STACK_SIZEOF(evictor_stack),
+			evictor_thread_entry, NULL, NULL, NULL,
+			K_LOWEST_APPLICATION_THREAD_PRIO, 0, K_NO_WAIT);
+	k_thread_name_set(&evictor_thread, "page_evictor");
+	evictor_started = true;
+
+	/* Faults during boot may already have used up the free frames */
+	k_sem_give(&evictor_sem);
+
+	return 0;
+}
+
+SYS_INIT(evictor_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#else
+static inline bool evictor_wake_needed_locked(void)
+{
+	return false;
+}
+
+static inline void evictor_wake(bool needed)
+{
+	ARG_UNUSED(needed);
+}
+#endif /* CONFIG_DEMAND_PAGING_ASYNC_EVICTION */
+
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+/* Page in the data pages following a faulting address, so sequential
+ * accesses don't take one page fault per page. Only paged-out data pages
+ * contiguous with the faulting one are read ahead, and only into free
+ * page frames: nothing is ever evicted for a speculative page-in.
+ */
+static void do_read_ahead(void *addr)
+{
+	struct z_page_frame *pfs[CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES];
+	uintptr_t locations[CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES];
+	uint8_t *base = UINT_TO_POINTER(ROUND_DOWN(POINTER_TO_UINT(addr),
+						   CONFIG_MMU_PAGE_SIZE));
+	uint8_t *pos = base;
+	size_t count = 0;
+	bool wake_evictor = false;
+	int key;
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	k_sched_lock();
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	key = irq_lock();
+	while (count < CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES) {
+		struct z_page_frame *pf;
+
+		pos += CONFIG_MMU_PAGE_SIZE;
+		if (pos >= Z_VIRT_RAM_END ||
+		    arch_page_location_get(pos, &locations[count]) !=
+		    ARCH_PAGE_LOCATION_PAGED_OUT) {
+			break;
+		}
+
+		pf = free_page_frame_list_get();
+		if (pf == NULL) {
+			break;
+		}
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+		/* Mark as busy so that z_page_frame_is_evictable() returns false */
+		z_page_frame_set(pf, Z_PAGE_FRAME_BUSY);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+		pfs[count] = pf;
+		count++;
+	}
+
+	if (count == 0) {
+		goto out;
+	}
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	irq_unlock(key);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	do_backing_store_page_in_batch(pfs, locations, count);
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	key = irq_lock();
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+
+	pos = base;
+	for (size_t i = 0; i < count; i++) {
+		pos += CONFIG_MMU_PAGE_SIZE;
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+		z_page_frame_clear(pfs[i], Z_PAGE_FRAME_BUSY);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+		frame_mapped_set(pfs[i], pos);
+		arch_mem_page_in(pos, z_page_frame_to_phys(pfs[i]));
+		k_mem_paging_backing_store_page_finalize(pfs[i], locations[i]);
+	}
+	paging_stats_read_ahead_inc(_current_cpu->current, count);
+	wake_evictor = evictor_wake_needed_locked();
+out:
+	irq_unlock(key);
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	k_sched_unlock();
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	evictor_wake(wake_evictor);
+}
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
+
 static bool do_page_fault(void *addr, bool pin)
 {
 	struct z_page_frame *pf;
@@ -1432,6 +1688,7 @@ static bool do_page_fault(void *addr, bool pin)
 	enum arch_page_location status;
 	bool result;
 	bool dirty = false;
+	bool wake_evictor = false;
 	struct k_thread *faulting_thread = _current_cpu->current;
 
 	__ASSERT(page_frames_initialized, "page fault at %p happened too early",
@@ -1543,11 +1800,13 @@ static bool do_page_fault(void *addr, bool pin)
 
 	arch_mem_page_in(addr, z_page_frame_to_phys(pf));
 	k_mem_paging_backing_store_page_finalize(pf, page_in_location);
+	wake_evictor = evictor_wake_needed_locked();
 out:
 	irq_unlock(key);
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
 	k_sched_unlock();
 #endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	evictor_wake(wake_evictor);
 
 	return result;
 }
@@ -1588,7 +1847,16 @@ void k_mem_pin(void *addr, size_t size)
 
 bool z_page_fault(void *addr)
 {
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+	if (!do_page_fault(addr, false)) {
+		return false;
+	}
+	do_read_ahead(addr);
+
+	return true;
+#else
 	return do_page_fault(addr, false);
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
 }
 
 static void do_mem_unpin(void *addr)
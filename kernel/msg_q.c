@@ -36,6 +36,234 @@ static inline void handle_poll_events(struct k_msgq *msgq, uint32_t state)
 }
 #endif /* CONFIG_POLL */
 
+static char *msgq_next(struct k_msgq *msgq, char *slot)
+{
+	slot += msgq->msg_size;
+	if (slot == msgq->buffer_end) {
+		slot = msgq->buffer_start;
+	}
+
+	return slot;
+}
+
+/* Returns true if a slot is free, the reserved one counting as used */
+static bool msgq_has_space(struct k_msgq *msgq)
+{
+	uint32_t used = msgq->used_msgs;
+
+	if ((msgq->flags & K_MSGQ_FLAG_PUT_RESERVED) != 0U) {
+		used++;
+	}
+
+	return used < msgq->max_msgs;
+}
+
+/* Returns the number of messages that can be received, the ones queued
+ * behind a reserved slot waiting for it to be committed.
+ */
+static uint32_t msgq_ready_msgs(struct k_msgq *msgq)
+{
+	size_t ahead;
+
+	if ((msgq->flags & K_MSGQ_FLAG_PUT_RESERVED) == 0U) {
+		return msgq->used_msgs;
+	}
+
+	if (msgq->reserved_ptr >= msgq->read_ptr) {
+		ahead = msgq->reserved_ptr - msgq->read_ptr;
+	} else {
+		ahead = (msgq->buffer_end - msgq->read_ptr) +
+			(msgq->reserved_ptr - msgq->buffer_start);
+	}
+
+	return ahead / msgq->msg_size;
+}
+
+#ifdef CONFIG_POLL
+bool z_msgq_data_available(struct k_msgq *msgq)
+{
+	return ((msgq->flags & K_MSGQ_FLAG_GET_PEEKED) == 0U) &&
+	       (msgq_ready_msgs(msgq) > 0U);
+}
+#endif /* CONFIG_POLL */
+
+/* Signals the poll events if a message can be received */
+static void msgq_signal(struct k_msgq *msgq)
+{
+#ifdef CONFIG_POLL
+	if (z_msgq_data_available(msgq)) {
+		handle_poll_events(msgq, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+	}
+#endif /* CONFIG_POLL */
+}
+
+/* A thread waiting in a put or a get, pointed to by its swap_data. Both
+ * kinds share the wait queue: producers wait for a free slot, consumers
+ * for a message, and either may wait for a zero-copy reservation or peek
+ * to end.
+ */
+struct msgq_waiter {
+	/* Message to put or buffer to get it into, NULL for zero-copy */
+	char *msg;
+	/* Slot handed to a zero-copy waiter */
+	char *slot;
+	bool put;
+};
+
+/* Queues the message in the write slot */
+static void msgq_push(struct k_msgq *msgq)
+{
+	msgq->write_ptr = msgq_next(msgq, msgq->write_ptr);
+	msgq->used_msgs++;
+}
+
+/* Dequeues the message in the read slot */
+static void msgq_pop(struct k_msgq *msgq)
+{
+	msgq->read_ptr = msgq_next(msgq, msgq->read_ptr);
+	msgq->used_msgs--;
+}
+
+/* Reserves the write slot for a zero-copy producer, the slot keeps its
+ * place in the queue while the next ones are filled.
+ */
+static char *msgq_reserve(struct k_msgq *msgq)
+{
+	msgq->reserved_ptr = msgq->write_ptr;
+	msgq->write_ptr = msgq_next(msgq, msgq->write_ptr);
+	msgq->flags |= K_MSGQ_FLAG_PUT_RESERVED;
+
+	return msgq->reserved_ptr;
+}
+
+/* Returns the first thread waiting to put, or to get, a message. Zero-copy
+ * producers are passed over while a slot is reserved.
+ */
+static struct k_thread *msgq_first_waiter(struct k_msgq *msgq, bool put)
+{
+	bool reserved = (msgq->flags & K_MSGQ_FLAG_PUT_RESERVED) != 0U;
+	struct k_thread *thread;
+
+	_WAIT_Q_FOR_EACH(&msgq->wait_q, thread) {
+		struct msgq_waiter *waiter = thread->base.swap_data;
+
+		if ((waiter->put == put) &&
+		    !(put && reserved && (waiter->msg == NULL))) {
+			return thread;
+		}
+	}
+
+	return NULL;
+}
+
+static void msgq_wake_waiter(struct k_thread *thread)
+{
+	z_unpend_thread(thread);
+	arch_thread_return_value_set(thread, 0);
+	z_ready_thread(thread);
+}
+
+/* Hands message @a msg to a thread waiting to get one, the queue being
+ * empty and no slot reserved.
+ */
+static void msgq_give(struct k_msgq *msgq, struct k_thread *thread,
+		      const char *msg)
+{
+	struct msgq_waiter *waiter = thread->base.swap_data;
+
+	if (waiter->msg == NULL) {
+		/* the message stays in the ring, peeked by the waiter */
+		(void)memcpy(msgq->write_ptr, msg, msgq->msg_size);
+		waiter->slot = msgq->write_ptr;
+		msgq_push(msgq);
+		msgq->flags |= K_MSGQ_FLAG_GET_PEEKED;
+	} else {
+		(void)memcpy(waiter->msg, msg, msgq->msg_size);
+	}
+
+	msgq_wake_waiter(thread);
+}
+
+/* Hands the message in the read slot to the first thread waiting to get
+ * one, returns true if a thread was woken up.
+ */
+static bool msgq_wake_getter(struct k_msgq *msgq)
+{
+	struct k_thread *thread;
+	struct msgq_waiter *waiter;
+
+	if (((msgq->flags & K_MSGQ_FLAG_GET_PEEKED) != 0U) ||
+	    (msgq_ready_msgs(msgq) == 0U)) {
+		return false;
+	}
+
+	thread = msgq_first_waiter(msgq, false);
+	if (thread == NULL) {
+		return false;
+	}
+
+	waiter = thread->base.swap_data;
+	if (waiter->msg == NULL) {
+		msgq->flags |= K_MSGQ_FLAG_GET_PEEKED;
+		waiter->slot = msgq->read_ptr;
+	} else {
+		(void)memcpy(waiter->msg, msgq->read_ptr, msgq->msg_size);
+		msgq_pop(msgq);
+	}
+
+	msgq_wake_waiter(thread);
+
+	return true;
+}
+
+/* Lets the first thread waiting to put a message use the write slot,
+ * returns true if a thread was woken up.
+ */
+static bool msgq_wake_putter(struct k_msgq *msgq)
+{
+	struct k_thread *thread;
+	struct msgq_waiter *waiter;
+
+	if (!msgq_has_space(msgq)) {
+		return false;
+	}
+
+	thread = msgq_first_waiter(msgq, true);
+	if (thread == NULL) {
+		return false;
+	}
+
+	__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
+			msgq->write_ptr < msgq->buffer_end);
+	waiter = thread->base.swap_data;
+	if (waiter->msg == NULL) {
+		waiter->slot = msgq_reserve(msgq);
+	} else {
+		/* add thread's message to queue */
+		(void)memcpy(msgq->write_ptr, waiter->msg, msgq->msg_size);
+		msgq_push(msgq);
+		msgq_signal(msgq);
+	}
+
+	msgq_wake_waiter(thread);
+
+	return true;
+}
+
+/* Serves the waiting threads that can proceed after a change of the queue
+ * state, returns true if any was woken up.
+ */
+static bool msgq_wake(struct k_msgq *msgq)
+{
+	bool woken = false;
+
+	while (msgq_wake_getter(msgq) || msgq_wake_putter(msgq)) {
+		woken = true;
+	}
+
+	return woken;
+}
+
 void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 		 uint32_t max_msgs)
 {
@@ -46,6 +274,7 @@ void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 	msgq->read_ptr = buffer;
 	msgq->write_ptr = buffer;
 	msgq->used_msgs = 0;
+	msgq->reserved_ptr = NULL;
 	msgq->flags = 0;
 	z_waitq_init(&msgq->wait_q);
 	msgq->lock = (struct k_spinlock) {};
@@ -126,6 +355,7 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout
 	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
 
 	struct k_thread *pending_thread;
+	struct msgq_waiter waiter;
 	k_spinlock_key_t key;
 	int result;
 
@@ -133,18 +363,18 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put, msgq, timeout);
 
-	if (msgq->used_msgs < msgq->max_msgs) {
-		/* message queue isn't full */
-		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+	if (msgq_has_space(msgq)) {
+		/* message queue isn't full, a message put behind a reserved
+		 * slot waits for it to be committed
+		 */
+		pending_thread = ((msgq->used_msgs == 0U) &&
+				  ((msgq->flags & K_MSGQ_FLAG_PUT_RESERVED) == 0U)) ?
+				 msgq_first_waiter(msgq, false) : NULL;
 		if (pending_thread != NULL) {
 			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, 0);
 
 			/* give message to waiting thread */
-			(void)memcpy(pending_thread->base.swap_data, data,
-			       msgq->msg_size);
-			/* wake up waiting thread */
-			arch_thread_return_value_set(pending_thread, 0);
-			z_ready_thread(pending_thread);
+			msgq_give(msgq, pending_thread, data);
 			z_reschedule(&msgq->lock, key);
 			return 0;
 		} else {
@@ -152,14 +382,8 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout
 			__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
 					msgq->write_ptr < msgq->buffer_end);
 			(void)memcpy(msgq->write_ptr, (char *)data, msgq->msg_size);
-			msgq->write_ptr += msgq->msg_size;
-			if (msgq->write_ptr == msgq->buffer_end) {
-				msgq->write_ptr = msgq->buffer_start;
-			}
-			msgq->used_msgs++;
-#ifdef CONFIG_POLL
-			handle_poll_events(msgq, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
-#endif /* CONFIG_POLL */
+			msgq_push(msgq);
+			msgq_signal(msgq);
 		}
 		result = 0;
 	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
@@ -169,7 +393,11 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout
 		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, put, msgq, timeout);
 
 		/* wait for put message success, failure, or timeout */
-		_current->base.swap_data = (void *) data;
+		waiter = (struct msgq_waiter) {
+			.msg = (char *)data,
+			.put = true,
+		};
+		_current->base.swap_data = &waiter;
 
 		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, result);
@@ -217,42 +445,25 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 {
 	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
 
+	struct msgq_waiter waiter;
 	k_spinlock_key_t key;
-	struct k_thread *pending_thread;
 	int result;
 
 	key = k_spin_lock(&msgq->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get, msgq, timeout);
 
-	if (msgq->used_msgs > 0U) {
+	/* a zero-copy consumer owns the read slot while it is peeked */
+	if (((msgq->flags & K_MSGQ_FLAG_GET_PEEKED) == 0U) &&
+	    (msgq_ready_msgs(msgq) > 0U)) {
 		/* take first available message from queue */
 		(void)memcpy((char *)data, msgq->read_ptr, msgq->msg_size);
-		msgq->read_ptr += msgq->msg_size;
-		if (msgq->read_ptr == msgq->buffer_end) {
-			msgq->read_ptr = msgq->buffer_start;
-		}
-		msgq->used_msgs--;
+		msgq_pop(msgq);
 
 		/* handle first thread waiting to write (if any) */
-		pending_thread = z_unpend_first_thread(&msgq->wait_q);
-		if (pending_thread != NULL) {
+		if (msgq_wake(msgq)) {
 			SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get, msgq, timeout);
 
-			/* add thread's message to queue */
-			__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
-					msgq->write_ptr < msgq->buffer_end);
-			(void)memcpy(msgq->write_ptr, (char *)pending_thread->base.swap_data,
-			       msgq->msg_size);
-			msgq->write_ptr += msgq->msg_size;
-			if (msgq->write_ptr == msgq->buffer_end) {
-				msgq->write_ptr = msgq->buffer_start;
-			}
-			msgq->used_msgs++;
-
-			/* wake up waiting thread */
-			arch_thread_return_value_set(pending_thread, 0);
-			z_ready_thread(pending_thread);
 			z_reschedule(&msgq->lock, key);
 
 			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get, msgq, timeout, 0);
@@ -267,7 +478,11 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get, msgq, timeout);
 
 		/* wait for get message success or timeout */
-		_current->base.swap_data = data;
+		waiter = (struct msgq_waiter) {
+			.msg = data,
+			.put = false,
+		};
+		_current->base.swap_data = &waiter;
 
 		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get, msgq, timeout, result);
@@ -300,7 +515,7 @@ int z_impl_k_msgq_peek(struct k_msgq *msgq, void *data)
 
 	key = k_spin_lock(&msgq->lock);
 
-	if (msgq->used_msgs > 0U) {
+	if (msgq_ready_msgs(msgq) > 0U) {
 		/* take first available message from queue */
 		(void)memcpy((char *)data, msgq->read_ptr, msgq->msg_size);
 		result = 0;
@@ -337,7 +552,7 @@ int z_impl_k_msgq_peek_at(struct k_msgq *msgq, void *data, uint32_t idx)
 
 	key = k_spin_lock(&msgq->lock);
 
-	if (msgq->used_msgs > idx) {
+	if (msgq_ready_msgs(msgq) > idx) {
 		bytes_to_end = (msgq->buffer_end - msgq->read_ptr);
 		byte_offset = idx * msgq->msg_size;
 		start_addr = msgq->read_ptr;
@@ -389,7 +604,15 @@ void z_impl_k_msgq_purge(struct k_msgq *msgq)
 	}
 
 	msgq->used_msgs = 0;
-	msgq->read_ptr = msgq->write_ptr;
+	if ((msgq->flags & K_MSGQ_FLAG_PUT_RESERVED) != 0U) {
+		/* the reserved slot stays, at the head of the queue */
+		msgq->read_ptr = msgq->reserved_ptr;
+		msgq->write_ptr = msgq_next(msgq, msgq->reserved_ptr);
+	} else {
+		msgq->read_ptr = msgq->write_ptr;
+	}
+	/* a peeked message is discarded too */
+	msgq->flags &= ~K_MSGQ_FLAG_GET_PEEKED;
 
 	z_reschedule(&msgq->lock, key);
 }
@@ -418,6 +641,192 @@ static inline uint32_t z_vrfy_k_msgq_num_used_get(struct k_msgq *msgq)
 
 #endif /* CONFIG_USERSPACE */
 
+int z_impl_k_msgq_alloc_put(struct k_msgq *msgq, void **data, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	struct msgq_waiter waiter;
+	k_spinlock_key_t key;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if ((msgq->flags & K_MSGQ_FLAG_PUT_RESERVED) != 0U) {
+		result = -EBUSY;
+	} else if (msgq_has_space(msgq)) {
+		*data = msgq_reserve(msgq);
+		result = 0;
+	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		result = -ENOMSG;
+	} else {
+		/* wait for a get to reserve the freed slot for us */
+		waiter = (struct msgq_waiter) {
+			.msg = NULL,
+			.put = true,
+		};
+		_current->base.swap_data = &waiter;
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		if (result == 0) {
+			*data = waiter.slot;
+		}
+		return result;
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return result;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_alloc_put(struct k_msgq *msgq, void **data,
+					  k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(data, sizeof(*data)));
+	/* the message is written straight into the ring buffer */
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(msgq->buffer_start,
+				      msgq->buffer_end - msgq->buffer_start));
+
+	return z_impl_k_msgq_alloc_put(msgq, data, timeout);
+}
+#include <syscalls/k_msgq_alloc_put_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_msgq_commit(struct k_msgq *msgq)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if ((msgq->flags & K_MSGQ_FLAG_PUT_RESERVED) == 0U) {
+		k_spin_unlock(&msgq->lock, key);
+		return -EINVAL;
+	}
+
+	/* the slot is already in the ring, behind the messages queued
+	 * before it was reserved and ahead of the ones queued since
+	 */
+	msgq->flags &= ~K_MSGQ_FLAG_PUT_RESERVED;
+	msgq->used_msgs++;
+	msgq_signal(msgq);
+
+	/* hand the messages to waiting consumers, and let a zero-copy
+	 * producer that waited for the reservation to end reserve a slot
+	 */
+	if (msgq_wake(msgq)) {
+		z_reschedule(&msgq->lock, key);
+		return 0;
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_commit(struct k_msgq *msgq)
+{
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+
+	return z_impl_k_msgq_commit(msgq);
+}
+#include <syscalls/k_msgq_commit_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_msgq_peek_get(struct k_msgq *msgq, void **data, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	struct msgq_waiter waiter;
+	k_spinlock_key_t key;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if ((msgq->flags & K_MSGQ_FLAG_GET_PEEKED) != 0U) {
+		result = -EBUSY;
+	} else if (msgq_ready_msgs(msgq) > 0U) {
+		msgq->flags |= K_MSGQ_FLAG_GET_PEEKED;
+		*data = msgq->read_ptr;
+		result = 0;
+	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		result = -ENOMSG;
+	} else {
+		/* wait for a put to leave its message in the read slot */
+		waiter = (struct msgq_waiter) {
+			.msg = NULL,
+			.put = false,
+		};
+		_current->base.swap_data = &waiter;
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		if (result == 0) {
+			*data = waiter.slot;
+		}
+		return result;
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return result;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_peek_get(struct k_msgq *msgq, void **data,
+					 k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(data, sizeof(*data)));
+	/* the message is read straight from the ring buffer */
+	K_OOPS(K_SYSCALL_MEMORY_READ(msgq->buffer_start,
+				     msgq->buffer_end - msgq->buffer_start));
+
+	return z_impl_k_msgq_peek_get(msgq, data, timeout);
+}
+#include <syscalls/k_msgq_peek_get_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_msgq_release(struct k_msgq *msgq)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if ((msgq->flags & K_MSGQ_FLAG_GET_PEEKED) == 0U) {
+		k_spin_unlock(&msgq->lock, key);
+		return -EINVAL;
+	}
+
+	msgq->flags &= ~K_MSGQ_FLAG_GET_PEEKED;
+	msgq_pop(msgq);
+
+	/* handle the consumers that waited for the message to be released,
+	 * and the producers waiting for the freed slot, then the pollers
+	 * that were not signaled while it was held
+	 */
+	if (msgq_wake(msgq)) {
+		msgq_signal(msgq);
+		z_reschedule(&msgq->lock, key);
+		return 0;
+	}
+
+	msgq_signal(msgq);
+	k_spin_unlock(&msgq->lock, key);
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_release(struct k_msgq *msgq)
+{
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+
+	return z_impl_k_msgq_release(msgq);
+}
+#include <syscalls/k_msgq_release_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
 #ifdef CONFIG_OBJ_CORE_MSGQ
 static int init_msgq_obj_core_list(void)
 {
@@ -102,18 +102,9 @@ static bool adjust_owner_prio(struct k_mutex *mutex, int32_t new_prio)
 	return false;
 }
 
-int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
+/* Must be called with the lock held */
+static bool mutex_try_take(struct k_mutex *mutex)
 {
-	int new_prio;
-	k_spinlock_key_t key;
-	bool resched = false;
-
-	__ASSERT(!arch_is_in_isr(), "mutexes cannot be used inside ISRs");
-
-	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mutex, lock, mutex, timeout);
-
-	key = k_spin_lock(&lock);
-
 	if (likely((mutex->lock_count == 0U) || (mutex->owner == _current))) {
 
 		mutex->owner_orig_prio = (mutex->lock_count == 0U) ?
@@ -127,6 +118,62 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 			_current, mutex, mutex->lock_count,
 			mutex->owner_orig_prio);
 
+		return true;
+	}
+
+	return false;
+}
+
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+/* If the owner of the mutex is running on another CPU it will likely
+ * release the mutex soon, and spinning for it is cheaper than a
+ * context switch away and back.  Spins (without the lock) for as long
+ * as the owner stays the same and keeps running, up to
+ * CONFIG_MUTEX_ADAPTIVE_SPIN_LIMIT iterations, then retries the lock.
+ * Returns true if the mutex was taken, with the lock held in any case.
+ */
+static bool mutex_spin_on_owner(struct k_mutex *mutex, k_spinlock_key_t *key)
+{
+	struct k_thread *owner = mutex->owner;
+	unsigned int cpu = owner->base.cpu;
+
+	if ((cpu == _current_cpu->id) || (_kernel.cpus[cpu].current != owner)) {
+		return false;
+	}
+
+	k_spin_unlock(&lock, *key);
+
+	for (int i = 0; i < CONFIG_MUTEX_ADAPTIVE_SPIN_LIMIT; i++) {
+		if ((*(struct k_thread * volatile *)&mutex->owner != owner) ||
+		    (*(struct k_thread * volatile *)&_kernel.cpus[cpu].current != owner)) {
+			break;
+		}
+
+		unsigned int k = arch_irq_lock();
+
+		arch_spin_relax(); /* Requires interrupts be masked */
+		arch_irq_unlock(k);
+	}
+
+	*key = k_spin_lock(&lock);
+
+	return mutex_try_take(mutex);
+}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
+int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
+{
+	int new_prio;
+	k_spinlock_key_t key;
+	bool resched = false;
+
+	__ASSERT(!arch_is_in_isr(), "mutexes cannot be used inside ISRs");
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mutex, lock, mutex, timeout);
+
+	key = k_spin_lock(&lock);
+
+	if (likely(mutex_try_take(mutex))) {
 		k_spin_unlock(&lock, key);
 
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, 0);
@@ -142,6 +189,16 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 		return -EBUSY;
 	}
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+	if (mutex_spin_on_owner(mutex, &key)) {
+		k_spin_unlock(&lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, 0);
+
+		return 0;
+	}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_mutex, lock, mutex, timeout);
 
 	new_prio = new_prio_for_inheritance(_current->base.prio,
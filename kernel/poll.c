@@ -24,6 +24,7 @@
 #include <zephyr/sys/dlist.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/sys/__assert.h>
+#include <zephyr/sys/barrier.h>
 #include <stdbool.h>
 
 /* Single subsystem lock.  Locking per-event would be better on highly
@@ -35,10 +36,12 @@
  */
 static struct k_spinlock lock;
 
-enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED };
+enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED, MODE_SET };
 
 static int signal_poller(struct k_poll_event *event, uint32_t state);
 static int signal_triggered_work(struct k_poll_event *event, uint32_t status);
+static int signal_set(struct k_poll_event *event, uint32_t state);
+static int signal_poll_event(struct k_poll_event *event, uint32_t state);
 
 void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 		       int mode, void *obj)
@@ -82,7 +85,7 @@ static inline bool is_condition_met(struct k_poll_event *event, uint32_t *state)
 		}
 		break;
 	case K_POLL_TYPE_MSGQ_DATA_AVAILABLE:
-		if (event->msgq->used_msgs > 0) {
+		if (z_msgq_data_available(event->msgq)) {
 			*state = K_POLL_STATE_MSGQ_DATA_AVAILABLE;
 			return true;
 		}
@@ -109,6 +112,18 @@ static struct k_thread *poller_thread(struct z_poller *p)
 	return p ? CONTAINER_OF(p, struct k_thread, poller) : NULL;
 }
 
+/* Poll sets have no thread of their own: they are notified after all
+ * the threads polling on the same object, in registration order.
+ */
+static inline bool poller_precedes(struct z_poller *a, struct z_poller *b)
+{
+	if ((a->mode == MODE_SET) || (b->mode == MODE_SET)) {
+		return (a->mode != MODE_SET);
+	}
+
+	return z_sched_prio_cmp(poller_thread(a), poller_thread(b)) > 0;
+}
+
 static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 			     struct z_poller *poller)
 {
@@ -116,15 +131,13 @@ static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 
 	pending = (struct k_poll_event *)sys_dlist_peek_tail(events);
 	if ((pending == NULL) ||
-		(z_sched_prio_cmp(poller_thread(pending->poller),
-							   poller_thread(poller)) > 0)) {
+	    poller_precedes(pending->poller, poller)) {
 		sys_dlist_append(events, &event->_node);
 		return;
 	}
 
 	SYS_DLIST_FOR_EACH_CONTAINER(events, pending, _node) {
-		if (z_sched_prio_cmp(poller_thread(poller),
-					poller_thread(pending->poller)) > 0) {
+		if (poller_precedes(poller, pending->poller)) {
 			sys_dlist_insert(&pending->_node, &event->_node);
 			return;
 		}
@@ -169,6 +182,23 @@ static inline void register_event(struct k_poll_event *event,
 	}
 
 	event->poller = poller;
+
+#ifdef CONFIG_QUEUE_ATOMIC_FAST_PATH
+	/* k_queue producers add items without the lock, then look for
+	 * registered events.  Look at the queue again now that the event
+	 * is registered, in case an item came in after the condition was
+	 * checked: one of the two sides sees the other.
+	 */
+	if (event->type == K_POLL_TYPE_DATA_AVAILABLE) {
+		uint32_t state;
+
+		barrier_dmem_fence_full();
+		if (is_condition_met(event, &state)) {
+			sys_dlist_remove(&event->_node);
+			(void)signal_poll_event(event, state);
+		}
+	}
+#endif /* CONFIG_QUEUE_ATOMIC_FAST_PATH */
 }
 
 /* must be called with interrupts locked */
@@ -443,6 +473,10 @@ static int signal_poll_event(struct k_poll_event *event, uint32_t state)
 	struct z_poller *poller = event->poller;
 	int retcode = 0;
 
+	if ((poller != NULL) && (poller->mode == MODE_SET)) {
+		return signal_set(event, state);
+	}
+
 	if (poller != NULL) {
 		if (poller->mode == MODE_POLL) {
 			retcode = signal_poller(event, state);
@@ -567,6 +601,158 @@ static inline void z_vrfy_k_poll_signal_reset(struct k_poll_signal *sig)
 
 #endif /* CONFIG_USERSPACE */
 
+/* must be called with interrupts locked */
+static int signal_set(struct k_poll_event *event, uint32_t state)
+{
+	struct k_poll_set *set =
+		CONTAINER_OF(event->poller, struct k_poll_set, poller);
+	struct k_thread *thread;
+
+	/* The event was taken off its object's list by the notifier, it
+	 * stays off it until a waiter has looked at it. Its condition is
+	 * checked again at that point, a waiter may have consumed the
+	 * object in the meantime.
+	 */
+	sys_dlist_append(&set->ready, &event->_node);
+
+	thread = z_unpend_first_thread(&set->wait_q);
+	if (thread != NULL) {
+		arch_thread_return_value_set(thread,
+			state == K_POLL_STATE_CANCELLED ? -EINTR : 0);
+		z_ready_thread(thread);
+	}
+
+	return 0;
+}
+
+void k_poll_set_init(struct k_poll_set *set)
+{
+	set->poller.is_polling = false;
+	set->poller.mode = MODE_SET;
+	sys_dlist_init(&set->ready);
+	z_waitq_init(&set->wait_q);
+}
+
+int k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	uint32_t state;
+
+	if (event->poller != NULL) {
+		k_spin_unlock(&lock, key);
+		return -EBUSY;
+	}
+
+	event->state = K_POLL_STATE_NOT_READY;
+	if (is_condition_met(event, &state)) {
+		event->poller = &set->poller;
+		(void)signal_set(event, state);
+		z_reschedule(&lock, key);
+		return 0;
+	}
+
+	register_event(event, &set->poller);
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+int k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (event->poller != &set->poller) {
+		k_spin_unlock(&lock, key);
+		return -EINVAL;
+	}
+
+	/* Either on its object's list or on the ready list */
+	if (sys_dnode_is_linked(&event->_node)) {
+		sys_dlist_remove(&event->_node);
+	}
+	event->poller = NULL;
+	event->state = K_POLL_STATE_NOT_READY;
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+/* must be called with interrupts locked */
+static int collect_ready(struct k_poll_set *set, struct k_poll_event **ready,
+			 int max)
+{
+	sys_dlist_t still_ready;
+	struct k_poll_event *event;
+	uint32_t state;
+	int count = 0;
+
+	sys_dlist_init(&still_ready);
+
+	while (count < max) {
+		event = (struct k_poll_event *)sys_dlist_get(&set->ready);
+		if (event == NULL) {
+			break;
+		}
+
+		/* Events still ready stay on the ready list, the others go
+		 * back to their objects to wait for the next notification.
+		 */
+		if (is_condition_met(event, &state)) {
+			event->state = state;
+			ready[count++] = event;
+			sys_dlist_append(&still_ready, &event->_node);
+		} else {
+			event->state = K_POLL_STATE_NOT_READY;
+			register_event(event, &set->poller);
+		}
+	}
+
+	/* Returned events go behind those not looked at yet */
+	while ((event = (struct k_poll_event *)sys_dlist_get(&still_ready))
+	       != NULL) {
+		sys_dlist_append(&set->ready, &event->_node);
+	}
+
+	return count;
+}
+
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **ready,
+		    int max, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	int count, ret = 0;
+
+	__ASSERT(!arch_is_in_isr(), "");
+	__ASSERT(ready != NULL, "NULL ready events\n");
+	__ASSERT(max > 0, "no room for ready events\n");
+
+	key = k_spin_lock(&lock);
+
+	for (;;) {
+		count = collect_ready(set, ready, max);
+		if ((count > 0) || (ret == -EINTR) ||
+		    K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			break;
+		}
+
+		/* Woken up by a notification, a cancellation or the timeout,
+		 * the latter two make the next attempt the last one.
+		 */
+		ret = z_pend_curr(&lock, key, &set->wait_q, timeout);
+		key = k_spin_lock(&lock);
+		timeout = sys_timepoint_timeout(end);
+	}
+
+	k_spin_unlock(&lock, key);
+
+	if (count > 0) {
+		return count;
+	}
+
+	return (ret == -EINTR) ? -EINTR : -EAGAIN;
+}
+
 static void triggered_work_handler(struct k_work *work)
 {
 	struct k_work_poll *twork =
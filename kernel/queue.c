@@ -21,6 +21,7 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <kernel_internal.h>
 #include <zephyr/sys/check.h>
+#include <zephyr/sys/barrier.h>
 
 struct alloc_node {
 	sys_sfnode_t node;
@@ -55,11 +56,146 @@ void *z_queue_node_peek(sys_sfnode_t *node, bool needs_free)
 	return ret;
 }
 
+#ifdef CONFIG_QUEUE_ATOMIC_FAST_PATH
+/* With the fast path, producers push items onto queue->inbox, a LIFO
+ * chained through the first word of each item, with a single CAS and
+ * without taking the lock.  Consumers (and every other locked
+ * operation) swap the inbox out and replay it, oldest first, into
+ * data_q.  Before a thread pends, the inbox is set to
+ * Z_QUEUE_INBOX_CONTENDED with the lock held: producers then take the
+ * locked path and find the thread in the wait queue.  Only lock
+ * holders ever remove entries, so there is no ABA problem.
+ */
+#define INBOX_PREPEND 0x2UL
+
+static inline bool inbox_has_items(void *head)
+{
+	return (uintptr_t)head > (uintptr_t)Z_QUEUE_INBOX_CONTENDED;
+}
+
+static inline bool queue_push(struct k_queue *queue, void *data,
+			      bool is_append)
+{
+	uintptr_t link = (uintptr_t)data | (is_append ? 0UL : INBOX_PREPEND);
+	void *head;
+
+	do {
+		head = atomic_ptr_get(&queue->inbox);
+		if (head == Z_QUEUE_INBOX_CONTENDED) {
+			return false;
+		}
+		*(void **)data = head;
+	} while (!atomic_ptr_cas(&queue->inbox, head, (void *)link));
+
+	return true;
+}
+
+/* Called with the lock held */
+static void queue_drain(struct k_queue *queue)
+{
+	uintptr_t link, next, rev = 0UL;
+	sys_sfnode_t *node;
+	void *head;
+
+	do {
+		head = atomic_ptr_get(&queue->inbox);
+		if (!inbox_has_items(head)) {
+			return;
+		}
+	} while (!atomic_ptr_cas(&queue->inbox, head, NULL));
+
+	/* Entries are linked newest first, put them back in order */
+	for (link = (uintptr_t)head; link != 0UL; link = next) {
+		node = (sys_sfnode_t *)(link & ~INBOX_PREPEND);
+		next = *(uintptr_t *)node;
+		*(uintptr_t *)node = rev;
+		rev = link;
+	}
+
+	for (link = rev; link != 0UL; link = next) {
+		node = (sys_sfnode_t *)(link & ~INBOX_PREPEND);
+		next = *(uintptr_t *)node;
+		sys_sfnode_init(node, 0x0);
+		if ((link & INBOX_PREPEND) != 0UL) {
+			sys_sflist_prepend(&queue->data_q, node);
+		} else {
+			sys_sflist_append(&queue->data_q, node);
+		}
+	}
+}
+
+/* Called with the lock held, after waking up pending threads */
+static inline void queue_uncontend(struct k_queue *queue)
+{
+	if (z_waitq_head(&queue->wait_q) == NULL) {
+		(void)atomic_ptr_cas(&queue->inbox, Z_QUEUE_INBOX_CONTENDED,
+				     NULL);
+	}
+}
+
+/* For the operations that historically run without the lock */
+static void queue_flush(struct k_queue *queue)
+{
+	if (inbox_has_items(atomic_ptr_get(&queue->inbox))) {
+		k_spinlock_key_t key = k_spin_lock(&queue->lock);
+
+		queue_drain(queue);
+		k_spin_unlock(&queue->lock, key);
+	}
+}
+#else
+static inline void queue_drain(struct k_queue *queue)
+{
+	ARG_UNUSED(queue);
+}
+
+static inline void queue_uncontend(struct k_queue *queue)
+{
+	ARG_UNUSED(queue);
+}
+
+static inline void queue_flush(struct k_queue *queue)
+{
+	ARG_UNUSED(queue);
+}
+#endif /* CONFIG_QUEUE_ATOMIC_FAST_PATH */
+
+/* Called with the lock held.  Returns false if the queue is empty, in
+ * which case it has also been marked contended if @a will_pend is set.
+ */
+static bool queue_fill(struct k_queue *queue, bool will_pend)
+{
+#ifdef CONFIG_QUEUE_ATOMIC_FAST_PATH
+	void *head;
+
+	do {
+		queue_drain(queue);
+		if (!sys_sflist_is_empty(&queue->data_q)) {
+			return true;
+		}
+		if (!will_pend) {
+			return false;
+		}
+		head = atomic_ptr_get(&queue->inbox);
+	} while ((head != Z_QUEUE_INBOX_CONTENDED) &&
+		 !atomic_ptr_cas(&queue->inbox, NULL, Z_QUEUE_INBOX_CONTENDED));
+
+	return false;
+#else
+	ARG_UNUSED(will_pend);
+
+	return !sys_sflist_is_empty(&queue->data_q);
+#endif /* CONFIG_QUEUE_ATOMIC_FAST_PATH */
+}
+
 void z_impl_k_queue_init(struct k_queue *queue)
 {
 	sys_sflist_init(&queue->data_q);
 	queue->lock = (struct k_spinlock) {};
 	z_waitq_init(&queue->wait_q);
+#ifdef CONFIG_QUEUE_ATOMIC_FAST_PATH
+	atomic_ptr_clear(&queue->inbox);
+#endif /* CONFIG_QUEUE_ATOMIC_FAST_PATH */
 #if defined(CONFIG_POLL)
 	sys_dlist_init(&queue->poll_events);
 #endif
@@ -106,6 +242,7 @@ void z_impl_k_queue_cancel_wait(struct k_queue *queue)
 	if (first_pending_thread != NULL) {
 		prepare_thread_to_run(first_pending_thread, NULL);
 	}
+	queue_uncontend(queue);
 
 	handle_poll_events(queue, K_POLL_STATE_CANCELLED);
 	z_reschedule(&queue->lock, key);
@@ -124,14 +261,36 @@ static int32_t queue_insert(struct k_queue *queue, void *prev, void *data,
 			    bool alloc, bool is_append)
 {
 	struct k_thread *first_pending_thread;
-	k_spinlock_key_t key = k_spin_lock(&queue->lock);
+	k_spinlock_key_t key;
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, queue_insert, queue, alloc);
 
+#ifdef CONFIG_QUEUE_ATOMIC_FAST_PATH
+	if (!alloc && (prev == NULL) && queue_push(queue, data, is_append)) {
+#ifdef CONFIG_POLL
+		/* k_poll() registers its event, then looks at the inbox
+		 * again: one of the two sides sees the other.
+		 */
+		barrier_dmem_fence_full();
+		if (!sys_dlist_is_empty(&queue->poll_events)) {
+			handle_poll_events(queue, K_POLL_STATE_DATA_AVAILABLE);
+			z_reschedule_unlocked();
+		}
+#endif /* CONFIG_POLL */
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, queue_insert, queue, alloc, 0);
+
+		return 0;
+	}
+#endif /* CONFIG_QUEUE_ATOMIC_FAST_PATH */
+
+	key = k_spin_lock(&queue->lock);
+	queue_drain(queue);
+
 	if (is_append) {
 		prev = sys_sflist_peek_tail(&queue->data_q);
 	}
 	first_pending_thread = z_unpend_first_thread(&queue->wait_q);
+	queue_uncontend(queue);
 
 	if (first_pending_thread != NULL) {
 		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_queue, queue_insert, queue, alloc, K_FOREVER);
@@ -258,6 +417,8 @@ int k_queue_append_list(struct k_queue *queue, void *head, void *tail)
 	k_spinlock_key_t key = k_spin_lock(&queue->lock);
 	struct k_thread *thread = NULL;
 
+	queue_drain(queue);
+
 	if (head != NULL) {
 		thread = z_unpend_first_thread(&queue->wait_q);
 	}
@@ -267,6 +428,7 @@ int k_queue_append_list(struct k_queue *queue, void *head, void *tail)
 		head = *(void **)head;
 		thread = z_unpend_first_thread(&queue->wait_q);
 	}
+	queue_uncontend(queue);
 
 	if (head != NULL) {
 		sys_sflist_append_list(&queue->data_q, head, tail);
@@ -321,7 +483,7 @@ void *z_impl_k_queue_get(struct k_queue *queue, k_timeout_t timeout)
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, get, queue, timeout);
 
-	if (likely(!sys_sflist_is_empty(&queue->data_q))) {
+	if (likely(queue_fill(queue, !K_TIMEOUT_EQ(timeout, K_NO_WAIT)))) {
 		sys_sfnode_t *node;
 
 		node = sys_sflist_get_not_empty(&queue->data_q);
@@ -355,6 +517,8 @@ bool k_queue_remove(struct k_queue *queue, void *data)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, remove, queue);
 
+	queue_flush(queue);
+
 	bool ret = sys_sflist_find_and_remove(&queue->data_q, (sys_sfnode_t *)data);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, remove, queue, ret);
@@ -368,6 +532,8 @@ bool k_queue_unique_append(struct k_queue *queue, void *data)
 
 	sys_sfnode_t *test;
 
+	queue_flush(queue);
+
 	SYS_SFLIST_FOR_EACH_NODE(&queue->data_q, test) {
 		if (test == (sys_sfnode_t *) data) {
 			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, unique_append, queue, false);
@@ -385,6 +551,8 @@ bool k_queue_unique_append(struct k_queue *queue, void *data)
 
 void *z_impl_k_queue_peek_head(struct k_queue *queue)
 {
+	queue_flush(queue);
+
 	void *ret = z_queue_node_peek(sys_sflist_peek_head(&queue->data_q), false);
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_queue, peek_head, queue, ret);
@@ -394,6 +562,8 @@ void *z_impl_k_queue_peek_head(struct k_queue *queue)
 
 void *z_impl_k_queue_peek_tail(struct k_queue *queue)
 {
+	queue_flush(queue);
+
 	void *ret = z_queue_node_peek(sys_sflist_peek_tail(&queue->data_q), false);
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_queue, peek_tail, queue, ret);
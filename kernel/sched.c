@@ -36,6 +36,7 @@ struct k_spinlock _sched_spinlock;
 __incoherent struct k_thread _thread_dummy;
 
 static void update_cache(int preempt_ok);
+static int32_t z_tick_sleep(k_ticks_t ticks);
 static void halt_thread(struct k_thread *thread, uint8_t new_state);
 static void add_to_waitq_locked(struct k_thread *thread, _wait_q_t *wait_q);
 
@@ -45,6 +46,17 @@ BUILD_ASSERT(CONFIG_NUM_COOP_PRIORITIES >= CONFIG_NUM_METAIRQ_PRIORITIES,
 	     "CONFIG_NUM_METAIRQ_PRIORITIES as Meta IRQs are just a special class of cooperative "
 	     "threads.");
 
+#ifdef CONFIG_SCHED_DEADLINE_PERIODIC
+static inline int32_t period_rank(struct k_thread *thread)
+{
+	if (thread->base.period.period == 0U) {
+		return 1;
+	}
+
+	return thread->base.period.throttled ? 0 : 2;
+}
+#endif /* CONFIG_SCHED_DEADLINE_PERIODIC */
+
 /*
  * Return value same as e.g. memcmp
  * > 0 -> thread 1 priority  > thread 2 priority
@@ -75,6 +87,18 @@ int32_t z_sched_prio_cmp(struct k_thread *thread_1,
 	uint32_t d1 = thread_1->base.prio_deadline;
 	uint32_t d2 = thread_2->base.prio_deadline;
 
+#ifdef CONFIG_SCHED_DEADLINE_PERIODIC
+	/* Threads within their reservation run ahead of the others,
+	 * and those out of budget after them.
+	 */
+	int32_t r1 = period_rank(thread_1);
+	int32_t r2 = period_rank(thread_2);
+
+	if (r1 != r2) {
+		return r1 - r2;
+	}
+#endif /* CONFIG_SCHED_DEADLINE_PERIODIC */
+
 	if (d1 != d2) {
 		/* Sooner deadline means higher effective priority.
 		 * Doing the calculation with unsigned types and casting
@@ -121,6 +145,9 @@ static ALWAYS_INLINE void runq_add(struct k_thread *thread)
 	__ASSERT_NO_MSG(!z_is_idle_thread_object(thread));
 
 	_priq_run_add(thread_runq(thread), thread);
+#ifdef CONFIG_SCHED_LATENCY_STATS
+	CONTAINER_OF(thread_runq(thread), struct _ready_q, runq)->num_queued++;
+#endif /* CONFIG_SCHED_LATENCY_STATS */
 }
 
 static ALWAYS_INLINE void runq_remove(struct k_thread *thread)
@@ -128,6 +155,9 @@ static ALWAYS_INLINE void runq_remove(struct k_thread *thread)
 	__ASSERT_NO_MSG(!z_is_idle_thread_object(thread));
 
 	_priq_run_remove(thread_runq(thread), thread);
+#ifdef CONFIG_SCHED_LATENCY_STATS
+	CONTAINER_OF(thread_runq(thread), struct _ready_q, runq)->num_queued--;
+#endif /* CONFIG_SCHED_LATENCY_STATS */
 }
 
 static ALWAYS_INLINE struct k_thread *runq_best(void)
@@ -370,7 +400,132 @@ static bool thread_active_elsewhere(struct k_thread *thread)
 	return false;
 }
 
-static void ready_thread(struct k_thread *thread)
+#ifdef CONFIG_SCHED_DEADLINE_PERIODIC
+/* Sum of the utilizations admitted by k_thread_period_set() */
+static uint32_t period_util;
+
+#define PERIOD_UTIL_BOUND \
+	((CONFIG_SCHED_DEADLINE_UTILIZATION_BOUND << 16) / 100)
+
+/* Starts the period of the thread containing now, which must not be
+ * before the current one, with a full budget.  This changes the
+ * sorting order, so the thread can't be in the run queue.
+ */
+static void period_start(struct k_thread *thread, uint32_t now)
+{
+	struct _thread_period *p = &thread->base.period;
+
+	p->release += ((now - p->release) / p->period) * p->period;
+	p->remaining = p->budget;
+	p->throttled = false;
+	thread->base.prio_deadline = p->release + p->deadline;
+	(void)z_abort_timeout(&p->timeout);
+}
+
+/* A thread waking up in a later period starts it right away, rather
+ * than running with the deadline and budget left over from the last
+ * one.
+ */
+static void period_wakeup(struct k_thread *thread)
+{
+	struct _thread_period *p = &thread->base.period;
+	uint32_t now;
+
+	if (p->period == 0U) {
+		return;
+	}
+
+	now = k_cycle_get_32();
+	if ((int32_t)(now - p->release) >= (int32_t)p->period) {
+		period_start(thread, now);
+	}
+}
+
+static void period_replenish(struct _timeout *timeout)
+{
+	struct k_thread *thread = CONTAINER_OF(timeout, struct k_thread,
+					       base.period.timeout);
+	struct _thread_period *p = &thread->base.period;
+	k_spinlock_key_t key = k_spin_lock(&_sched_spinlock);
+	uint32_t next = p->release + p->period;
+	uint32_t now = k_cycle_get_32();
+
+	/* Threads that aren't runnable are replenished when woken */
+	if (p->throttled && !z_is_thread_prevented_from_running(thread)) {
+		if ((int32_t)(now - next) < 0) {
+			now = next;
+		}
+
+		bool queued = z_is_thread_queued(thread);
+
+		if (queued) {
+			dequeue_thread(thread);
+		}
+		period_start(thread, now);
+		if (queued) {
+			queue_thread(thread);
+			update_cache(0);
+			flag_ipi(ipi_mask_create(thread));
+		}
+
+		/* Running here: arm its budget timer again */
+		if (thread == _current) {
+			z_reset_time_slice(thread);
+		}
+#ifdef CONFIG_SMP
+		/* Running on another CPU: arm it for that CPU, which must
+		 * reschedule now that the thread is back in its reservation
+		 */
+		if (thread_active_elsewhere(thread)) {
+			z_reset_time_slice_cpu(thread->base.cpu, thread);
+			flag_ipi(IPI_CPU_MASK(thread->base.cpu));
+		}
+#endif /* CONFIG_SMP */
+	}
+
+	k_spin_unlock(&_sched_spinlock, key);
+}
+
+void z_sched_period_throttle(struct k_thread *thread)
+{
+	struct _thread_period *p = &thread->base.period;
+	uint32_t now = k_cycle_get_32();
+	int32_t left = (int32_t)(p->release + p->period - now);
+
+	if (z_is_thread_queued(thread)) {
+		dequeue_thread(thread);
+	}
+
+	p->overruns++;
+	if (left > 0) {
+		p->throttled = true;
+		z_add_timeout(&p->timeout, period_replenish, K_CYC(left));
+	} else {
+		period_start(thread, now);
+	}
+
+	move_thread_to_end_of_prio_q(thread);
+}
+
+static void period_exit(struct k_thread *thread)
+{
+	period_util -= thread->base.period.util;
+	thread->base.period.util = 0U;
+	thread->base.period.period = 0U;
+	(void)z_abort_timeout(&thread->base.period.timeout);
+}
+#else
+static inline void period_wakeup(struct k_thread *thread)
+{
+	ARG_UNUSED(thread);
+}
+#endif /* CONFIG_SCHED_DEADLINE_PERIODIC */
+
+/* Adds thread to the run queue without touching the cache or
+ * flagging an IPI, so batched wakeups can do both only once.
+ * Returns true if the thread was queued.
+ */
+static bool queue_ready_thread(struct k_thread *thread)
 {
 #ifdef CONFIG_KERNEL_COHERENCE
 	__ASSERT_NO_MSG(arch_mem_coherent(thread));
@@ -382,9 +537,20 @@ static void ready_thread(struct k_thread *thread)
 	if (!z_is_thread_queued(thread) && z_is_thread_ready(thread)) {
 		SYS_PORT_TRACING_OBJ_FUNC(k_thread, sched_ready, thread);
 
+		z_sched_latency_ready(thread);
+		period_wakeup(thread);
 		queue_thread(thread);
+		return true;
+	}
+
+	return false;
+}
+
+static void ready_thread(struct k_thread *thread)
+{
+	if (queue_ready_thread(thread)) {
 		update_cache(0);
-		flag_ipi();
+		flag_ipi(ipi_mask_create(thread));
 	}
 }
 
@@ -470,7 +636,11 @@ static void z_thread_halt(struct k_thread *thread, k_spinlock_key_t key,
 		thread->base.thread_state |= (terminate ? _THREAD_ABORTING
 					      : _THREAD_SUSPENDING);
 #if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
+#ifdef CONFIG_ARCH_HAS_DIRECTED_IPIS
+		arch_sched_directed_ipi(IPI_CPU_MASK(thread->base.cpu));
+#else
 		arch_sched_ipi();
+#endif /* CONFIG_ARCH_HAS_DIRECTED_IPIS */
 #endif
 		if (arch_is_in_isr()) {
 			thread_halt_spin(thread, key);
@@ -741,8 +911,17 @@ bool z_thread_prio_set(struct k_thread *thread, int prio)
 				dequeue_thread(thread);
 				thread->base.prio = prio;
 				queue_thread(thread);
+				flag_ipi(ipi_mask_create(thread));
 			} else {
 				thread->base.prio = prio;
+#ifdef CONFIG_SMP
+				/* Running elsewhere: only its CPU may need
+				 * to switch to another thread.
+				 */
+				if (thread_active_elsewhere(thread)) {
+					flag_ipi(IPI_CPU_MASK(thread->base.cpu));
+				}
+#endif /* CONFIG_SMP */
 			}
 			update_cache(1);
 		} else {
@@ -976,7 +1155,7 @@ void init_ready_q(struct _ready_q *ready_q)
 		}
 	};
 #elif defined(CONFIG_SCHED_MULTIQ)
-	for (int i = 0; i < ARRAY_SIZE(_kernel.ready_q.runq.queues); i++) {
+	for (int i = 0; i < ARRAY_SIZE(ready_q->runq.queues); i++) {
 		sys_dlist_init(&ready_q->runq.queues[i]);
 	}
 #else
@@ -1006,7 +1185,6 @@ void z_impl_k_thread_priority_set(k_tid_t thread, int prio)
 
 	bool need_sched = z_thread_prio_set((struct k_thread *)thread, prio);
 
-	flag_ipi();
 	if (need_sched && (_current->base.sched_locked == 0U)) {
 		z_reschedule_unlocked();
 	}
@@ -1067,6 +1245,163 @@ static inline void z_vrfy_k_thread_deadline_set(k_tid_t tid, int deadline)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_SCHED_DEADLINE */
 
+#ifdef CONFIG_SCHED_DEADLINE_PERIODIC
+int z_impl_k_thread_period_set(k_tid_t tid, uint32_t period,
+			       uint32_t budget, uint32_t deadline)
+{
+	struct k_thread *thread = tid;
+	struct _thread_period *p = &thread->base.period;
+	uint32_t util = 0U;
+	int ret = 0;
+
+	if (deadline == 0U) {
+		deadline = period;
+	}
+
+	if (period != 0U) {
+		if ((period > INT32_MAX) || (budget == 0U) ||
+		    (deadline > period) || (budget > deadline)) {
+			return -EINVAL;
+		}
+		util = (uint32_t)(((uint64_t)budget << 16) / deadline);
+	}
+
+	K_SPINLOCK(&_sched_spinlock) {
+		bool queued = z_is_thread_queued(thread);
+
+		if (period_util - p->util + util > PERIOD_UTIL_BOUND) {
+			ret = -EBUSY;
+			K_SPINLOCK_BREAK;
+		}
+		period_util = period_util - p->util + util;
+
+		if (queued) {
+			dequeue_thread(thread);
+		}
+
+		(void)z_abort_timeout(&p->timeout);
+		p->period = period;
+		p->budget = budget;
+		p->deadline = deadline;
+		p->util = util;
+		p->throttled = false;
+		p->jobs = 0U;
+		p->misses = 0U;
+		p->overruns = 0U;
+		if (period != 0U) {
+			p->release = k_cycle_get_32();
+			period_start(thread, p->release);
+		}
+
+		if (queued) {
+			queue_thread(thread);
+			update_cache(0);
+		}
+
+		if (thread == _current) {
+			z_reset_time_slice(thread);
+		}
+	}
+
+	return ret;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_thread_period_set(k_tid_t tid, uint32_t period,
+					     uint32_t budget, uint32_t deadline)
+{
+	struct k_thread *thread = tid;
+
+	K_OOPS(K_SYSCALL_OBJ(thread, K_OBJ_THREAD));
+
+	return z_impl_k_thread_period_set((k_tid_t)thread, period, budget,
+					  deadline);
+}
+#include <syscalls/k_thread_period_set_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_thread_period_wait(void)
+{
+	struct _thread_period *p = &_current->base.period;
+	k_spinlock_key_t key = k_spin_lock(&_sched_spinlock);
+	uint32_t now = k_cycle_get_32();
+	uint32_t next = p->release + p->period;
+	bool late = (int32_t)(now - next) >= 0;
+	bool queued;
+
+	if (p->period == 0U) {
+		k_spin_unlock(&_sched_spinlock, key);
+		return -EINVAL;
+	}
+
+	p->jobs++;
+	if ((int32_t)(now - (p->release + p->deadline)) > 0) {
+		p->misses++;
+	}
+
+	/* Set up the next job now, so it doesn't look like a wakeup
+	 * in a later period when the sleep below ends.
+	 */
+	queued = z_is_thread_queued(_current);
+	if (queued) {
+		dequeue_thread(_current);
+	}
+	if (late) {
+		period_start(_current, now);
+	} else {
+		p->release = next;
+		period_start(_current, next);
+	}
+	if (queued) {
+		queue_thread(_current);
+	}
+	z_reset_time_slice(_current);
+	k_spin_unlock(&_sched_spinlock, key);
+
+	if (late) {
+		/* Let threads with earlier deadlines go first */
+		z_impl_k_yield();
+		return 0;
+	}
+
+	return (z_tick_sleep(k_cyc_to_ticks_ceil32(next - now)) == 0) ? 0 : -EAGAIN;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_thread_period_wait(void)
+{
+	return z_impl_k_thread_period_wait();
+}
+#include <syscalls/k_thread_period_wait_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+void z_impl_k_thread_period_stats_get(k_tid_t tid,
+				      struct k_thread_period_stats *stats)
+{
+	struct _thread_period *p = &tid->base.period;
+
+	K_SPINLOCK(&_sched_spinlock) {
+		stats->jobs = p->jobs;
+		stats->misses = p->misses;
+		stats->overruns = p->overruns;
+	}
+}
+
+#ifdef CONFIG_USERSPACE
+static inline void z_vrfy_k_thread_period_stats_get(k_tid_t tid,
+						    struct k_thread_period_stats *stats)
+{
+	struct k_thread *thread = tid;
+
+	K_OOPS(K_SYSCALL_OBJ(thread, K_OBJ_THREAD));
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(stats, sizeof(*stats)));
+
+	z_impl_k_thread_period_stats_get((k_tid_t)thread, stats);
+}
+#include <syscalls/k_thread_period_stats_get_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+#endif /* CONFIG_SCHED_DEADLINE_PERIODIC */
+
 bool k_can_yield(void)
 {
 	return !(k_is_pre_kernel() || k_is_in_isr() ||
@@ -1308,6 +1643,9 @@ static void halt_thread(struct k_thread *thread, uint8_t new_state)
 			}
 			(void)z_abort_thread_timeout(thread);
 			unpend_all(&thread->join_queue);
+#ifdef CONFIG_SCHED_DEADLINE_PERIODIC
+			period_exit(thread);
+#endif /* CONFIG_SCHED_DEADLINE_PERIODIC */
 
 			/* Edge case: aborting _current from within an
 			 * ISR that preempted it requires clearing the
@@ -1526,6 +1864,78 @@ bool z_sched_wake(_wait_q_t *wait_q, int swap_retval, void *swap_data)
 	return ret;
 }
 
+unsigned int z_sched_wake_n(_wait_q_t *wait_q, unsigned int n,
+			    int swap_retval, void *swap_data)
+{
+	struct k_thread *thread;
+	unsigned int woken = 0U;
+	bool queued = false;
+	uint32_t ipi_mask = 0U;
+
+	K_SPINLOCK(&_sched_spinlock) {
+		while (woken < n) {
+			thread = _priq_wait_best(&wait_q->waitq);
+			if (thread == NULL) {
+				break;
+			}
+
+			z_thread_return_value_set_with_data(thread,
+							    swap_retval,
+							    swap_data);
+			unpend_thread_no_timeout(thread);
+			(void)z_abort_thread_timeout(thread);
+			if (queue_ready_thread(thread)) {
+				ipi_mask |= ipi_mask_create(thread);
+				queued = true;
+			}
+			woken++;
+		}
+
+		/* One cache update and one IPI for the whole batch */
+		if (queued) {
+			update_cache(0);
+			flag_ipi(ipi_mask);
+		}
+	}
+
+	return woken;
+}
+
+#ifdef CONFIG_EVENTS
+void z_sched_wake_event_list(struct k_thread *head)
+{
+	struct k_thread *thread;
+	bool queued = false;
+	uint32_t ipi_mask = 0U;
+
+	K_SPINLOCK(&_sched_spinlock) {
+		for (thread = head; thread != NULL;
+		     thread = thread->next_event_link) {
+			thread->no_wake_on_timeout = false;
+
+			if ((thread->base.thread_state &
+			     (_THREAD_DEAD | _THREAD_ABORTING)) != 0U) {
+				continue;
+			}
+
+			if (thread->base.pended_on != NULL) {
+				unpend_thread_no_timeout(thread);
+			}
+			z_mark_thread_as_started(thread);
+			if (queue_ready_thread(thread)) {
+				ipi_mask |= ipi_mask_create(thread);
+				queued = true;
+			}
+		}
+
+		if (queued) {
+			update_cache(0);
+			flag_ipi(ipi_mask);
+		}
+	}
+}
+#endif /* CONFIG_EVENTS */
+
 int z_sched_wait(struct k_spinlock *lock, k_spinlock_key_t key,
 		 _wait_q_t *wait_q, k_timeout_t timeout, void **data)
 {
@@ -28,6 +28,7 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/tracing/tracing.h>
 #include <zephyr/sys/check.h>
+#include <limits.h>
 
 /* We use a system-wide lock to synchronize semaphores, which has
  * unfortunate performance impact vs. using a per-object lock
@@ -38,6 +39,101 @@
  */
 static struct k_spinlock lock;
 
+#ifdef CONFIG_SEM_ATOMIC_FAST_PATH
+/* With the fast path, sem->count is only ever modified atomically,
+ * and is set to SEM_CONTENDED (with the lock held) before a thread
+ * pends on the semaphore.  Takers may then grab any positive count,
+ * and givers may bump any non-contended count, with a single CAS;
+ * only waking or pending a thread needs the lock.
+ */
+#define SEM_CONTENDED ((atomic_val_t)-1)
+
+/* Counts beyond LONG_MAX can't coexist with SEM_CONTENDED on 32 bit
+ * targets, which is way more than any practical K_SEM_MAX_LIMIT use.
+ */
+static inline atomic_val_t sem_limit(struct k_sem *sem)
+{
+	return (atomic_val_t)MIN((unsigned long)sem->limit, (unsigned long)LONG_MAX);
+}
+
+static inline bool sem_try_take(struct k_sem *sem)
+{
+	atomic_val_t count;
+
+	do {
+		count = atomic_get(&sem->count);
+		if (count <= 0) {
+			return false;
+		}
+	} while (!atomic_cas(&sem->count, count, count - 1));
+
+	return true;
+}
+
+/* Returns false if threads may be pending, in which case the lock
+ * must be taken to wake one of them up.
+ */
+static inline bool sem_try_give(struct k_sem *sem)
+{
+	atomic_val_t count;
+
+	do {
+		count = atomic_get(&sem->count);
+		if (count == SEM_CONTENDED) {
+			return false;
+		}
+		if (count == sem_limit(sem)) {
+			return true;
+		}
+	} while (!atomic_cas(&sem->count, count, count + 1));
+
+	return true;
+}
+
+/* Called with the lock held and no count available: marks the
+ * semaphore contended so that givers take the locked path and find
+ * us in the wait queue.  Returns true instead if a count was given
+ * through the fast path in the meantime, and has been taken.
+ */
+static bool sem_take_or_contend(struct k_sem *sem)
+{
+	atomic_val_t count;
+
+	do {
+		if (sem_try_take(sem)) {
+			return true;
+		}
+		count = atomic_get(&sem->count);
+	} while ((count != SEM_CONTENDED) &&
+		 !atomic_cas(&sem->count, 0, SEM_CONTENDED));
+
+	return false;
+}
+#endif /* CONFIG_SEM_ATOMIC_FAST_PATH */
+
+/* Called with the lock held and nobody left waiting: adds n to the
+ * count, saturating at the limit.
+ */
+static void sem_add(struct k_sem *sem, unsigned int n)
+{
+#ifdef CONFIG_SEM_ATOMIC_FAST_PATH
+	atomic_val_t count;
+	atomic_val_t limit = sem_limit(sem);
+
+	/* Waiters that timed out leave the semaphore contended */
+	(void)atomic_cas(&sem->count, SEM_CONTENDED, 0);
+
+	do {
+		count = atomic_get(&sem->count);
+	} while (!atomic_cas(&sem->count, count,
+			     (n >= (unsigned long)(limit - count)) ?
+			     limit : count + (atomic_val_t)n));
+#else
+	sem->count = (n >= (sem->limit - sem->count)) ?
+		     sem->limit : (sem->count + n);
+#endif /* CONFIG_SEM_ATOMIC_FAST_PATH */
+}
+
 #ifdef CONFIG_OBJ_CORE_SEM
 static struct k_obj_type obj_type_sem;
 #endif /* CONFIG_OBJ_CORE_SEM */
@@ -54,7 +150,11 @@ int z_impl_k_sem_init(struct k_sem *sem, unsigned int initial_count,
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_SEM_ATOMIC_FAST_PATH
+	atomic_set(&sem->count, initial_count);
+#else
 	sem->count = initial_count;
+#endif /* CONFIG_SEM_ATOMIC_FAST_PATH */
 	sem->limit = limit;
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_sem, init, sem, 0);
@@ -95,19 +195,42 @@ static inline bool handle_poll_events(struct k_sem *sem)
 
 void z_impl_k_sem_give(struct k_sem *sem)
 {
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	k_spinlock_key_t key;
 	struct k_thread *thread;
 	bool resched = true;
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_sem, give, sem);
 
+#if defined(CONFIG_SEM_ATOMIC_FAST_PATH) && !defined(CONFIG_POLL)
+	if (sem_try_give(sem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_sem, give, sem);
+		return;
+	}
+#endif /* CONFIG_SEM_ATOMIC_FAST_PATH && !CONFIG_POLL */
+
+	key = k_spin_lock(&lock);
 	thread = z_unpend_first_thread(&sem->wait_q);
 
 	if (thread != NULL) {
 		arch_thread_return_value_set(thread, 0);
 		z_ready_thread(thread);
+#ifdef CONFIG_SEM_ATOMIC_FAST_PATH
+		if (z_waitq_head(&sem->wait_q) == NULL) {
+			/* Last waiter gone, reopen the fast path */
+			atomic_set(&sem->count, 0);
+		}
+#endif /* CONFIG_SEM_ATOMIC_FAST_PATH */
 	} else {
+#ifdef CONFIG_SEM_ATOMIC_FAST_PATH
+		/* Contended with nobody left waiting means the
+		 * waiters timed out; the count is zero then.
+		 */
+		if (!atomic_cas(&sem->count, SEM_CONTENDED, 1)) {
+			(void)sem_try_give(sem);
+		}
+#else
 		sem->count += (sem->count != sem->limit) ? 1U : 0U;
+#endif /* CONFIG_SEM_ATOMIC_FAST_PATH */
 		resched = handle_poll_events(sem);
 	}
 
@@ -129,6 +252,53 @@ static inline void z_vrfy_k_sem_give(struct k_sem *sem)
 #include <syscalls/k_sem_give_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+void z_impl_k_sem_give_n(struct k_sem *sem, unsigned int count)
+{
+	k_spinlock_key_t key;
+	unsigned int woken;
+	bool resched;
+
+	if (count == 0U) {
+		return;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_sem, give, sem);
+
+	key = k_spin_lock(&lock);
+	woken = z_sched_wake_n(&sem->wait_q, count, 0, NULL);
+	resched = (woken != 0U);
+
+	/* Either all gives went to waiters, or nobody is left waiting */
+	if (woken < count) {
+		sem_add(sem, count - woken);
+		resched = handle_poll_events(sem) || resched;
+	} else {
+#ifdef CONFIG_SEM_ATOMIC_FAST_PATH
+		if (z_waitq_head(&sem->wait_q) == NULL) {
+			/* Last waiter gone, reopen the fast path */
+			atomic_set(&sem->count, 0);
+		}
+#endif /* CONFIG_SEM_ATOMIC_FAST_PATH */
+	}
+
+	if (resched) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_sem, give, sem);
+}
+
+#ifdef CONFIG_USERSPACE
+static inline void z_vrfy_k_sem_give_n(struct k_sem *sem, unsigned int count)
+{
+	K_OOPS(K_SYSCALL_OBJ(sem, K_OBJ_SEM));
+	z_impl_k_sem_give_n(sem, count);
+}
+#include <syscalls/k_sem_give_n_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
 int z_impl_k_sem_take(struct k_sem *sem, k_timeout_t timeout)
 {
 	int ret;
@@ -136,6 +306,27 @@ int z_impl_k_sem_take(struct k_sem *sem, k_timeout_t timeout)
 	__ASSERT(((arch_is_in_isr() == false) ||
 		  K_TIMEOUT_EQ(timeout, K_NO_WAIT)), "");
 
+#ifdef CONFIG_SEM_ATOMIC_FAST_PATH
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_sem, take, sem, timeout);
+
+	if (likely(sem_try_take(sem))) {
+		ret = 0;
+		goto out;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		ret = -EBUSY;
+		goto out;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (sem_take_or_contend(sem)) {
+		k_spin_unlock(&lock, key);
+		ret = 0;
+		goto out;
+	}
+#else
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_sem, take, sem, timeout);
@@ -152,6 +343,7 @@ int z_impl_k_sem_take(struct k_sem *sem, k_timeout_t timeout)
 		ret = -EBUSY;
 		goto out;
 	}
+#endif /* CONFIG_SEM_ATOMIC_FAST_PATH */
 
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_sem, take, sem, timeout);
 
@@ -165,18 +357,14 @@ out:
 
 void z_impl_k_sem_reset(struct k_sem *sem)
 {
-	struct k_thread *thread;
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
-	while (true) {
-		thread = z_unpend_first_thread(&sem->wait_q);
-		if (thread == NULL) {
-			break;
-		}
-		arch_thread_return_value_set(thread, -EAGAIN);
-		z_ready_thread(thread);
-	}
+	(void)z_sched_wake_all(&sem->wait_q, -EAGAIN, NULL);
+#ifdef CONFIG_SEM_ATOMIC_FAST_PATH
+	atomic_set(&sem->count, 0);
+#else
 	sem->count = 0;
+#endif /* CONFIG_SEM_ATOMIC_FAST_PATH */
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_sem, reset, sem);
 
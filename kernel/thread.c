@@ -544,6 +544,9 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 	k_object_init(stack);
 	new_thread->stack_obj = stack;
 	new_thread->syscall_frame = NULL;
+#ifdef CONFIG_OBJ_VALIDATION_CACHE
+	(void)memset(&new_thread->obj_cache, 0, sizeof(new_thread->obj_cache));
+#endif /* CONFIG_OBJ_VALIDATION_CACHE */
 
 	/* Any given thread has access to itself */
 	k_object_access_grant(new_thread, new_thread);
@@ -635,6 +638,10 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 #ifdef CONFIG_SCHED_DEADLINE
 	new_thread->base.prio_deadline = 0;
 #endif /* CONFIG_SCHED_DEADLINE */
+#ifdef CONFIG_SCHED_DEADLINE_PERIODIC
+	new_thread->base.period = (struct _thread_period) {};
+	z_init_timeout(&new_thread->base.period.timeout);
+#endif /* CONFIG_SCHED_DEADLINE_PERIODIC */
 	new_thread->resource_pool = _current->resource_pool;
 
 #ifdef CONFIG_SMP
@@ -647,6 +654,11 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 		CONFIG_SCHED_THREAD_USAGE_AUTO_ENABLE;
 #endif /* CONFIG_SCHED_THREAD_USAGE */
 
+#ifdef CONFIG_SCHED_LATENCY_STATS
+	new_thread->base.ready_stamp = 0U;
+	new_thread->base.latency = (struct k_sched_latency_stats) {};
+#endif /* CONFIG_SCHED_LATENCY_STATS */
+
 	SYS_PORT_TRACING_OBJ_FUNC(k_thread, create, new_thread);
 
 	return stack_ptr;
@@ -991,6 +1003,16 @@ int k_thread_runtime_stats_all_get(k_thread_runtime_stats_t *stats)
 		stats->average_cycles   += tmp_stats.average_cycles;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 		stats->idle_cycles      += tmp_stats.idle_cycles;
+#ifdef CONFIG_SCHED_IPI_STATS
+		stats->ipi_count        += tmp_stats.ipi_count;
+#endif /* CONFIG_SCHED_IPI_STATS */
+#ifdef CONFIG_SCHED_LATENCY_STATS
+		for (int j = 0; j < CONFIG_SCHED_LATENCY_STATS_BUCKETS; j++) {
+			stats->latency.wakeup[j]  += tmp_stats.latency.wakeup[j];
+			stats->latency.preempt[j] += tmp_stats.latency.preempt[j];
+			stats->runq_depth[j]      += tmp_stats.runq_depth[j];
+		}
+#endif /* CONFIG_SCHED_LATENCY_STATS */
 	}
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
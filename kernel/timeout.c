@@ -14,7 +14,37 @@
 
 static uint64_t curr_tick;
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+/* Hierarchical timing wheel.  Each level has WHEEL_SLOTS buckets and
+ * resolves WHEEL_BITS more bits of the absolute expiry tick than the
+ * level below it.  A pending timeout lives at the level of the most
+ * significant WHEEL_BITS-wide digit in which its expiry differs from
+ * wheel_tick, so every level 0 bucket holds timeouts expiring on
+ * exactly one tick.  Higher level buckets are "cascaded" (their
+ * contents redistributed to lower levels) when wheel_tick reaches the
+ * start of their range.  Timeouts beyond the reach of the top level
+ * sit on an unsorted overflow list that is redistributed each time
+ * wheel_tick crosses a top level boundary.
+ *
+ * In this mode _timeout.dticks holds the absolute expiry tick rather
+ * than a delta from the previous timeout in the list.  Buckets are
+ * only valid while their bit in wheel_occupied[] is set.
+ */
+#define WHEEL_BITS 5
+#define WHEEL_SLOTS BIT(WHEEL_BITS)
+#define WHEEL_MASK (WHEEL_SLOTS - 1U)
+#define WHEEL_LEVELS CONFIG_TIMEOUT_WHEEL_LEVELS
+#define WHEEL_SPAN_BITS (WHEEL_BITS * WHEEL_LEVELS)
+
+BUILD_ASSERT(WHEEL_SPAN_BITS <= 32, "wheel digits must fit in 32 bits");
+
+static uint64_t wheel_tick;
+static uint32_t wheel_occupied[WHEEL_LEVELS];
+static sys_dlist_t wheel[WHEEL_LEVELS][WHEEL_SLOTS];
+static sys_dlist_t wheel_overflow = SYS_DLIST_STATIC_INIT(&wheel_overflow);
+#else
 static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 
 static struct k_spinlock timeout_lock;
 
@@ -36,6 +66,195 @@ static inline int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+/* Level a timeout expiring at @a expiry belongs to, relative to the
+ * current wheel position.  WHEEL_LEVELS means the overflow list.
+ */
+static int wheel_level(uint64_t expiry)
+{
+	uint64_t diff = expiry ^ wheel_tick;
+
+	if ((diff >> WHEEL_SPAN_BITS) != 0U) {
+		return WHEEL_LEVELS;
+	}
+
+	return (diff == 0U) ? 0 : (find_msb_set((uint32_t)diff) - 1) / WHEEL_BITS;
+}
+
+static inline unsigned int wheel_slot(uint64_t expiry, int level)
+{
+	return (expiry >> (WHEEL_BITS * level)) & WHEEL_MASK;
+}
+
+static void wheel_insert(struct _timeout *to)
+{
+	int level = wheel_level(to->dticks);
+	unsigned int slot;
+
+	if (level == WHEEL_LEVELS) {
+		sys_dlist_append(&wheel_overflow, &to->node);
+		return;
+	}
+
+	slot = wheel_slot(to->dticks, level);
+	if ((wheel_occupied[level] & BIT(slot)) == 0U) {
+		sys_dlist_init(&wheel[level][slot]);
+		wheel_occupied[level] |= BIT(slot);
+	}
+	sys_dlist_append(&wheel[level][slot], &to->node);
+}
+
+static void remove_timeout(struct _timeout *t)
+{
+	int level = wheel_level(t->dticks);
+	unsigned int slot;
+
+	sys_dlist_remove(&t->node);
+
+	if (level < WHEEL_LEVELS) {
+		slot = wheel_slot(t->dticks, level);
+		if (sys_dlist_is_empty(&wheel[level][slot])) {
+			wheel_occupied[level] &= ~BIT(slot);
+		}
+	}
+}
+
+/* Absolute tick of the next thing the wheel has to do from level
+ * @a min_level up: either the expiry of the earliest level 0 timeout,
+ * or the start of the first occupied bucket on a higher level (which
+ * must then be cascaded).  Returns UINT64_MAX if nothing is pending.
+ */
+static uint64_t wheel_next_event_from(int min_level)
+{
+	for (int level = min_level; level < WHEEL_LEVELS; level++) {
+		if (wheel_occupied[level] != 0U) {
+			unsigned int shift = WHEEL_BITS * level;
+			uint64_t slot = find_lsb_set(wheel_occupied[level]) - 1;
+
+			return (wheel_tick & ~BIT64_MASK(shift + WHEEL_BITS)) |
+			       (slot << shift);
+		}
+	}
+
+	if (!sys_dlist_is_empty(&wheel_overflow)) {
+		return (wheel_tick | BIT64_MASK(WHEEL_SPAN_BITS)) + 1U;
+	}
+
+	return UINT64_MAX;
+}
+
+static inline uint64_t wheel_next_event(void)
+{
+	return wheel_next_event_from(0);
+}
+
+#ifdef CONFIG_TIMEOUT_SLACK
+/* Absolute tick by which the wheel must next be serviced: the earliest
+ * expiry plus slack of a level 0 timeout, or the next cascade if that
+ * comes first, as the timeouts it brings down may have less slack.
+ * Buckets are visited in expiry order, so only those within the best
+ * slack window found so far are looked at.
+ */
+static uint64_t wheel_next_wakeup(void)
+{
+	uint64_t base = wheel_tick & ~(uint64_t)WHEEL_MASK;
+	uint64_t best = wheel_next_event_from(1);
+	uint32_t occupied = wheel_occupied[0];
+
+	while (occupied != 0U) {
+		unsigned int slot = find_lsb_set(occupied) - 1;
+		sys_dnode_t *node;
+
+		if ((base | slot) >= best) {
+			break;
+		}
+
+		SYS_DLIST_FOR_EACH_NODE(&wheel[0][slot], node) {
+			struct _timeout *t = CONTAINER_OF(node, struct _timeout, node);
+
+			best = MIN(best, (uint64_t)t->dticks + t->slack);
+		}
+		occupied &= ~BIT(slot);
+	}
+
+	return best;
+}
+#else
+static inline uint64_t wheel_next_wakeup(void)
+{
+	return wheel_next_event();
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
+static void wheel_take(sys_dlist_t *dst, sys_dlist_t *src)
+{
+	sys_dnode_t *node;
+
+	while ((node = sys_dlist_get(src)) != NULL) {
+		sys_dlist_append(dst, node);
+	}
+}
+
+/* Move the wheel position to @a tick, which must not be later than
+ * wheel_next_event(), redistributing every bucket whose range starts
+ * there.  Bucket order is preserved, so timeouts with equal expiry
+ * still fire in the order they were added.
+ */
+static void wheel_advance(uint64_t tick)
+{
+	uint64_t changed = tick ^ wheel_tick;
+	sys_dlist_t cascade;
+	sys_dnode_t *node;
+
+	if (changed == 0U) {
+		return;
+	}
+
+	sys_dlist_init(&cascade);
+	wheel_tick = tick;
+
+	if ((changed >> WHEEL_SPAN_BITS) != 0U) {
+		wheel_take(&cascade, &wheel_overflow);
+	}
+
+	for (int level = WHEEL_LEVELS - 1; level > 0; level--) {
+		unsigned int slot = wheel_slot(tick, level);
+
+		if (((changed >> (WHEEL_BITS * level)) != 0U) &&
+		    ((wheel_occupied[level] & BIT(slot)) != 0U)) {
+			wheel_take(&cascade, &wheel[level][slot]);
+			wheel_occupied[level] &= ~BIT(slot);
+		}
+	}
+
+	while ((node = sys_dlist_get(&cascade)) != NULL) {
+		wheel_insert(CONTAINER_OF(node, struct _timeout, node));
+	}
+}
+
+/* First timeout expiring at or before absolute tick @a limit, or NULL.
+ * Advances the wheel up to that timeout's expiry.
+ */
+static struct _timeout *wheel_first_expired(uint64_t limit)
+{
+	uint64_t next;
+
+	for (next = wheel_next_event(); next <= limit;
+	     next = wheel_next_event()) {
+		unsigned int slot = wheel_slot(next, 0);
+
+		wheel_advance(next);
+
+		if ((wheel_occupied[0] & BIT(slot)) != 0U) {
+			sys_dnode_t *t = sys_dlist_peek_head(&wheel[0][slot]);
+
+			return CONTAINER_OF(t, struct _timeout, node);
+		}
+	}
+
+	return NULL;
+}
+#else
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -59,6 +278,53 @@ static void remove_timeout(struct _timeout *t)
 	sys_dlist_remove(&t->node);
 }
 
+/* Ticks from curr_tick by which the first timeout must expire, or
+ * INT64_MAX if none is pending.  With slack that is the earliest
+ * expiry plus slack of any timeout; the list is sorted by expiry, so
+ * only the timeouts within the best slack window found so far are
+ * looked at.
+ */
+static int64_t first_wakeup(void)
+{
+#ifdef CONFIG_TIMEOUT_SLACK
+	int64_t expiry = 0;
+	int64_t best = INT64_MAX;
+
+	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
+		expiry += t->dticks;
+		if (expiry >= best) {
+			break;
+		}
+		best = MIN(best, expiry + t->slack);
+	}
+
+	return best;
+#else
+	struct _timeout *to = first();
+
+	return (to == NULL) ? INT64_MAX : to->dticks;
+#endif /* CONFIG_TIMEOUT_SLACK */
+}
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+
+#ifdef CONFIG_TIMEOUT_SLACK
+static struct k_timeout_slack_stats slack_stats;
+
+/* Accounts a timeout expiring at curr_tick during an announcement,
+ * @a last being the tick the previous one expired at in the same
+ * announcement, or UINT64_MAX for the first one.
+ */
+static void slack_count(uint64_t *last)
+{
+	if (*last == UINT64_MAX) {
+		slack_stats.wakeups++;
+	} else if (*last != curr_tick) {
+		slack_stats.merged++;
+	}
+	*last = curr_tick;
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 static int32_t elapsed(void)
 {
 	/* While sys_clock_announce() is executing, new relative timeouts will be
@@ -80,21 +346,45 @@ static int32_t elapsed(void)
 	return announce_remaining == 0 ? sys_clock_elapsed() : 0U;
 }
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
 static int32_t next_timeout(void)
 {
-	struct _timeout *to = first();
+	uint64_t next = wheel_next_wakeup();
 	int32_t ticks_elapsed = elapsed();
+	int64_t dticks = (int64_t)(next - curr_tick);
 	int32_t ret;
 
-	if ((to == NULL) ||
-	    ((int64_t)(to->dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
+	if ((next == UINT64_MAX) ||
+	    ((dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
 		ret = MAX_WAIT;
 	} else {
-		ret = MAX(0, to->dticks - ticks_elapsed);
+		ret = MAX(0, dticks - ticks_elapsed);
 	}
 
 	return ret;
 }
+#else
+/* Timeout to program for a wakeup @a dticks from curr_tick */
+static int32_t wakeup_timeout(int64_t dticks)
+{
+	int32_t ticks_elapsed = elapsed();
+	int32_t ret;
+
+	if ((dticks == INT64_MAX) ||
+	    ((dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
+		ret = MAX_WAIT;
+	} else {
+		ret = MAX(0, dticks - ticks_elapsed);
+	}
+
+	return ret;
+}
+
+static int32_t next_timeout(void)
+{
+	return wakeup_timeout(first_wakeup());
+}
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 
 void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 		   k_timeout_t timeout)
@@ -111,7 +401,11 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 	to->fn = fn;
 
 	K_SPINLOCK(&timeout_lock) {
+#ifndef CONFIG_TIMEOUT_QUEUE_WHEEL
 		struct _timeout *t;
+		int64_t prev_wakeup = first_wakeup();
+		int64_t wakeup;
+#endif /* !CONFIG_TIMEOUT_QUEUE_WHEEL */
 
 		if (IS_ENABLED(CONFIG_TIMEOUT_64BIT) &&
 		    (Z_TICK_ABS(timeout.ticks) >= 0)) {
@@ -122,6 +416,24 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 			to->dticks = timeout.ticks + 1 + elapsed();
 		}
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+		uint64_t prev_next = wheel_next_wakeup();
+
+		to->dticks += curr_tick;
+		wheel_insert(to);
+
+		if ((wheel_next_wakeup() < prev_next) && announce_remaining == 0) {
+			sys_clock_set_timeout(next_timeout(), false);
+		}
+#else
+		/* The new timeout can only bring the first wakeup earlier,
+		 * to its own expiry plus slack.
+		 */
+		wakeup = to->dticks;
+#ifdef CONFIG_TIMEOUT_SLACK
+		wakeup += to->slack;
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 		for (t = first(); t != NULL; t = next(t)) {
 			if (t->dticks > to->dticks) {
 				t->dticks -= to->dticks;
@@ -135,9 +447,10 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 			sys_dlist_append(&timeout_list, &to->node);
 		}
 
-		if (to == first() && announce_remaining == 0) {
-			sys_clock_set_timeout(next_timeout(), false);
+		if ((wakeup < prev_wakeup) && announce_remaining == 0) {
+			sys_clock_set_timeout(wakeup_timeout(wakeup), false);
 		}
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 	}
 }
 
@@ -158,6 +471,9 @@ int z_abort_timeout(struct _timeout *to)
 /* must be locked */
 static k_ticks_t timeout_rem(const struct _timeout *timeout)
 {
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	return timeout->dticks - curr_tick;
+#else
 	k_ticks_t ticks = 0;
 
 	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
@@ -168,6 +484,7 @@ static k_ticks_t timeout_rem(const struct _timeout *timeout)
 	}
 
 	return ticks;
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 }
 
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
@@ -226,13 +543,41 @@ void sys_clock_announce(int32_t ticks)
 	announce_remaining = ticks;
 
 	struct _timeout *t;
+#ifdef CONFIG_TIMEOUT_SLACK
+	uint64_t last_expiry = UINT64_MAX;
+#endif /* CONFIG_TIMEOUT_SLACK */
+
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	for (t = wheel_first_expired(curr_tick + announce_remaining);
+	     t != NULL;
+	     t = wheel_first_expired(curr_tick + announce_remaining)) {
+		int dt = t->dticks - curr_tick;
+
+		curr_tick += dt;
+#ifdef CONFIG_TIMEOUT_SLACK
+		slack_count(&last_expiry);
+#endif /* CONFIG_TIMEOUT_SLACK */
+		remove_timeout(t);
+		t->dticks = 0;
+
+		k_spin_unlock(&timeout_lock, key);
+		t->fn(t);
+		key = k_spin_lock(&timeout_lock);
+		announce_remaining -= dt;
+	}
 
+	curr_tick += announce_remaining;
+	wheel_advance(curr_tick);
+#else
 	for (t = first();
 	     (t != NULL) && (t->dticks <= announce_remaining);
 	     t = first()) {
 		int dt = t->dticks;
 
 		curr_tick += dt;
+#ifdef CONFIG_TIMEOUT_SLACK
+		slack_count(&last_expiry);
+#endif /* CONFIG_TIMEOUT_SLACK */
 		t->dticks = 0;
 		remove_timeout(t);
 
@@ -247,6 +592,7 @@ void sys_clock_announce(int32_t ticks)
 	}
 
 	curr_tick += announce_remaining;
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 	announce_remaining = 0;
 
 	sys_clock_set_timeout(next_timeout(), false);
@@ -290,6 +636,24 @@ static inline int64_t z_vrfy_k_uptime_ticks(void)
 #include <syscalls/k_uptime_ticks_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+#ifdef CONFIG_TIMEOUT_SLACK
+void z_impl_k_timeout_slack_stats_get(struct k_timeout_slack_stats *stats)
+{
+	K_SPINLOCK(&timeout_lock) {
+		*stats = slack_stats;
+	}
+}
+
+#ifdef CONFIG_USERSPACE
+static inline void z_vrfy_k_timeout_slack_stats_get(struct k_timeout_slack_stats *stats)
+{
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(stats, sizeof(*stats)));
+	z_impl_k_timeout_slack_stats_get(stats);
+}
+#include <syscalls/k_timeout_slack_stats_get_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 k_timepoint_t sys_timepoint_calc(k_timeout_t timeout)
 {
 	k_timepoint_t timepoint;
@@ -328,8 +692,45 @@ k_timeout_t sys_timepoint_timeout(k_timepoint_t timepoint)
 }
 
 #ifdef CONFIG_ZTEST
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+/* Expiries are absolute in the wheel, so keep pending timeouts at the
+ * same distance from the new current tick.
+ */
+static void wheel_rebase(uint64_t tick)
+{
+	sys_dlist_t pending;
+	sys_dnode_t *node;
+
+	sys_dlist_init(&pending);
+	wheel_take(&pending, &wheel_overflow);
+
+	for (int level = 0; level < WHEEL_LEVELS; level++) {
+		for (unsigned int slot = 0; slot < WHEEL_SLOTS; slot++) {
+			if ((wheel_occupied[level] & BIT(slot)) != 0U) {
+				wheel_take(&pending, &wheel[level][slot]);
+			}
+		}
+		wheel_occupied[level] = 0U;
+	}
+
+	wheel_tick = tick;
+
+	while ((node = sys_dlist_get(&pending)) != NULL) {
+		struct _timeout *t = CONTAINER_OF(node, struct _timeout, node);
+
+		t->dticks = t->dticks - curr_tick + tick;
+		wheel_insert(t);
+	}
+}
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+
 void z_impl_sys_clock_tick_set(uint64_t tick)
 {
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	K_SPINLOCK(&timeout_lock) {
+		wheel_rebase(tick);
+	}
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 	curr_tick = tick;
 }
 
@@ -13,6 +13,23 @@ static int slice_max_prio = CONFIG_TIMESLICE_PRIORITY;
 static struct _timeout slice_timeouts[CONFIG_MP_MAX_NUM_CPUS];
 static bool slice_expired[CONFIG_MP_MAX_NUM_CPUS];
 
+#ifdef CONFIG_SCHED_DEADLINE_PERIODIC
+/* Thread charged for the time run on each CPU, and since when */
+static struct k_thread *budget_thread[CONFIG_MP_MAX_NUM_CPUS];
+static uint32_t budget_start[CONFIG_MP_MAX_NUM_CPUS];
+
+static void budget_charge(int cpu)
+{
+	uint32_t now = k_cycle_get_32();
+
+	if (budget_thread[cpu] != NULL) {
+		budget_thread[cpu]->base.period.remaining -=
+			(int32_t)(now - budget_start[cpu]);
+	}
+	budget_start[cpu] = now;
+}
+#endif /* CONFIG_SCHED_DEADLINE_PERIODIC */
+
 #ifdef CONFIG_SWAP_NONATOMIC
 /* If z_swap() isn't atomic, then it's possible for a timer interrupt
  * to try to timeslice away _current after it has already pended
@@ -58,20 +75,41 @@ static void slice_timeout(struct _timeout *timeout)
 	slice_expired[cpu] = true;
 
 	/* We need an IPI if we just handled a timeslice expiration
-	 * for a different CPU.  Ideally this would be able to target
-	 * the specific core, but that's not part of the API yet.
+	 * for a different CPU.
 	 */
 	if (IS_ENABLED(CONFIG_SMP) && cpu != _current_cpu->id) {
-		flag_ipi();
+		flag_ipi(IPI_CPU_MASK(cpu));
 	}
 }
 
 void z_reset_time_slice(struct k_thread *thread)
 {
-	int cpu = _current_cpu->id;
+	z_reset_time_slice_cpu(_current_cpu->id, thread);
+}
 
+void z_reset_time_slice_cpu(int cpu, struct k_thread *thread)
+{
 	z_abort_timeout(&slice_timeouts[cpu]);
 	slice_expired[cpu] = false;
+
+#ifdef CONFIG_SCHED_DEADLINE_PERIODIC
+	/* Preemptible threads within their reservation get a slice of
+	 * the budget they have left instead.
+	 */
+	budget_charge(cpu);
+	budget_thread[cpu] = NULL;
+	if (z_sched_period_active(thread) && thread_is_preemptible(thread) &&
+	    !z_is_thread_prevented_from_running(thread)) {
+		int32_t ticks = k_cyc_to_ticks_ceil32(
+			MAX(thread->base.period.remaining, 1));
+
+		budget_thread[cpu] = thread;
+		z_add_timeout(&slice_timeouts[cpu], slice_timeout,
+			      K_TICKS(MAX(ticks - 1, 0)));
+		return;
+	}
+#endif /* CONFIG_SCHED_DEADLINE_PERIODIC */
+
 	if (thread_is_sliceable(thread)) {
 		z_add_timeout(&slice_timeouts[cpu], slice_timeout,
 			      K_TICKS(slice_time(thread) - 1));
@@ -115,6 +153,20 @@ void z_time_slice(void)
 	pending_current = NULL;
 #endif
 
+#ifdef CONFIG_SCHED_DEADLINE_PERIODIC
+	if (slice_expired[_current_cpu->id] &&
+	    (budget_thread[_current_cpu->id] == curr)) {
+		budget_charge(_current_cpu->id);
+		if ((curr->base.period.remaining <= 0) &&
+		    !z_is_thread_prevented_from_running(curr)) {
+			z_sched_period_throttle(curr);
+		}
+		z_reset_time_slice(curr);
+		k_spin_unlock(&_sched_spinlock, key);
+		return;
+	}
+#endif /* CONFIG_SCHED_DEADLINE_PERIODIC */
+
 	if (slice_expired[_current_cpu->id] && thread_is_sliceable(curr)) {
 #ifdef CONFIG_TIMESLICE_PER_THREAD
 		if (curr->base.slice_expired) {
@@ -10,6 +10,7 @@
 #include <ksched.h>
 #include <zephyr/spinlock.h>
 #include <zephyr/sys/check.h>
+#include <zephyr/sys/math_extras.h>
 
 /* Need one of these for this to work */
 #if !defined(CONFIG_USE_SWITCH) && !defined(CONFIG_INSTRUMENT_THREAD_SWITCHING)
@@ -71,8 +72,80 @@ static void sched_thread_update_usage(struct k_thread *thread, uint32_t cycles)
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 }
 
+#ifdef CONFIG_SCHED_LATENCY_STATS
+static unsigned int latency_bucket(uint32_t value)
+{
+	unsigned int bucket = 32U - u32_count_leading_zeros(value);
+
+	return MIN(bucket, CONFIG_SCHED_LATENCY_STATS_BUCKETS - 1U);
+}
+
+void z_sched_latency_ready(struct k_thread *thread)
+{
+	thread->base.ready_stamp = usage_now();
+	thread->base.ready_preempted = false;
+}
+
+static void sched_latency_stop(struct _cpu *cpu)
+{
+	struct k_thread *thread = cpu->current;
+
+	/* Still queued means still runnable: preempted or yielding */
+	if (z_is_thread_queued(thread)) {
+		thread->base.ready_stamp = usage_now();
+		thread->base.ready_preempted = true;
+	}
+
+	cpu->latency_prev = thread;
+}
+
+static void sched_latency_start(struct _cpu *cpu, struct k_thread *thread)
+{
+	uint32_t stamp = thread->base.ready_stamp;
+	uint32_t depth;
+	unsigned int i;
+
+	thread->base.ready_stamp = 0U;
+
+	/* Stopped and restarted without a switch, e.g. around an ISR */
+	if (thread == cpu->latency_prev) {
+		return;
+	}
+
+	if (stamp != 0U) {
+		i = latency_bucket(usage_now() - stamp);
+
+		if (thread->base.ready_preempted) {
+			thread->base.latency.preempt[i]++;
+			cpu->latency.preempt[i]++;
+		} else {
+			thread->base.latency.wakeup[i]++;
+			cpu->latency.wakeup[i]++;
+		}
+	}
+
+#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+	depth = cpu->ready_q.num_queued;
+#else
+	depth = _kernel.ready_q.num_queued;
+#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY */
+
+	/* Without SMP the running thread stays in the run queue */
+	if (!IS_ENABLED(CONFIG_SMP) && z_is_thread_queued(thread)) {
+		depth--;
+	}
+
+	cpu->runq_depth[latency_bucket(depth)]++;
+}
+#else
+#define sched_latency_stop(cpu)             do { } while (0)
+#define sched_latency_start(cpu, thread)    do { } while (0)
+#endif /* CONFIG_SCHED_LATENCY_STATS */
+
 void z_sched_usage_start(struct k_thread *thread)
 {
+	sched_latency_start(_current_cpu, thread);
+
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
 	k_spinlock_key_t  key;
 
@@ -104,6 +177,8 @@ void z_sched_usage_stop(void)
 
 	uint32_t u0 = cpu->usage0;
 
+	sched_latency_stop(cpu);
+
 	if (u0 != 0) {
 		uint32_t cycles = usage_now() - u0;
 
@@ -166,6 +241,16 @@ void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
 
 	stats->execution_cycles = stats->total_cycles + stats->idle_cycles;
 
+#ifdef CONFIG_SCHED_IPI_STATS
+	stats->ipi_count = _kernel.cpus[cpu_id].ipi_count;
+#endif /* CONFIG_SCHED_IPI_STATS */
+
+#ifdef CONFIG_SCHED_LATENCY_STATS
+	stats->latency = _kernel.cpus[cpu_id].latency;
+	memcpy(stats->runq_depth, _kernel.cpus[cpu_id].runq_depth,
+	       sizeof(stats->runq_depth));
+#endif /* CONFIG_SCHED_LATENCY_STATS */
+
 	k_spin_unlock(&usage_lock, key);
 }
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
@@ -221,6 +306,15 @@ void z_sched_thread_usage(struct k_thread *thread,
 	stats->idle_cycles = 0;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
+#ifdef CONFIG_SCHED_IPI_STATS
+	stats->ipi_count = 0;
+#endif /* CONFIG_SCHED_IPI_STATS */
+
+#ifdef CONFIG_SCHED_LATENCY_STATS
+	stats->latency = thread->base.latency;
+	memset(stats->runq_depth, 0, sizeof(stats->runq_depth));
+#endif /* CONFIG_SCHED_LATENCY_STATS */
+
 	k_spin_unlock(&usage_lock, key);
 }
 
@@ -383,6 +477,10 @@ int z_thread_stats_reset(struct k_obj_core *obj_core)
 	stats->num_windows = (thread->base.usage.track_usage) ?  1U : 0U;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 
+#ifdef CONFIG_SCHED_LATENCY_STATS
+	thread->base.latency = (struct k_sched_latency_stats) {};
+#endif /* CONFIG_SCHED_LATENCY_STATS */
+
 	if (thread != _current_cpu->current) {
 
 		/*
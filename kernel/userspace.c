@@ -79,6 +79,32 @@ extern uint8_t _thread_idx_map[CONFIG_MAX_THREAD_BYTES];
 
 static void clear_perms_cb(struct k_object *ko, void *ctx_ptr);
 
+#ifdef CONFIG_OBJ_VALIDATION_CACHE
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_OBJ_VALIDATION_CACHE_SIZE),
+	     "validation cache size must be a power of two");
+
+/* Bumped whenever a permission is revoked or an object freed, after the
+ * fact, flushing every thread's validation cache on its next lookup.
+ */
+static atomic_t obj_cache_gen;
+
+static void obj_cache_invalidate(void)
+{
+	(void)atomic_inc(&obj_cache_gen);
+}
+
+static inline unsigned int obj_cache_idx(const void *obj)
+{
+	/* Kernel objects are at least word aligned */
+	return (POINTER_TO_UINT(obj) / sizeof(void *)) &
+	       (CONFIG_OBJ_VALIDATION_CACHE_SIZE - 1U);
+}
+#else
+static inline void obj_cache_invalidate(void)
+{
+}
+#endif /* CONFIG_OBJ_VALIDATION_CACHE */
+
 const char *otype_to_str(enum k_objects otype)
 {
 	const char *ret;
@@ -478,6 +504,7 @@ void k_object_free(void *obj)
 	k_spin_unlock(&objfree_lock, key);
 
 	if (dyn != NULL) {
+		obj_cache_invalidate();
 		k_free(dyn->data);
 		k_free(dyn);
 	}
@@ -538,6 +565,7 @@ static void unref_check(struct k_object *ko, uintptr_t index)
 	k_spinlock_key_t key = k_spin_lock(&obj_lock);
 
 	sys_bitfield_clear_bit((mem_addr_t)&ko->perms, index);
+	obj_cache_invalidate();
 
 #ifdef CONFIG_DYNAMIC_OBJECTS
 	if ((ko->flags & K_OBJ_FLAG_ALLOC) == 0U) {
@@ -729,6 +757,27 @@ void k_object_access_all_grant(const void *object)
 	}
 }
 
+static inline int k_object_validate_init(struct k_object *ko,
+					 enum _obj_init_check init)
+{
+	/* Initialization state checks. _OBJ_INIT_ANY, we don't care */
+	if (likely(init == _OBJ_INIT_TRUE)) {
+		/* Object MUST be initialized */
+		if (unlikely((ko->flags & K_OBJ_FLAG_INITIALIZED) == 0U)) {
+			return -EINVAL;
+		}
+	} else if (init == _OBJ_INIT_FALSE) { /* _OBJ_INIT_FALSE case */
+		/* Object MUST NOT be initialized */
+		if (unlikely((ko->flags & K_OBJ_FLAG_INITIALIZED) != 0U)) {
+			return -EADDRINUSE;
+		}
+	} else {
+		/* _OBJ_INIT_ANY */
+	}
+
+	return 0;
+}
+
 int k_object_validate(struct k_object *ko, enum k_objects otype,
 		       enum _obj_init_check init)
 {
@@ -744,22 +793,58 @@ int k_object_validate(struct k_object *ko, enum k_objects otype,
 		return -EPERM;
 	}
 
-	/* Initialization state checks. _OBJ_INIT_ANY, we don't care */
-	if (likely(init == _OBJ_INIT_TRUE)) {
-		/* Object MUST be initialized */
-		if (unlikely((ko->flags & K_OBJ_FLAG_INITIALIZED) == 0U)) {
-			return -EINVAL;
-		}
-	} else if (init == _OBJ_INIT_FALSE) { /* _OBJ_INIT_FALSE case */
-		/* Object MUST NOT be initialized */
-		if (unlikely((ko->flags & K_OBJ_FLAG_INITIALIZED) != 0U)) {
-			return -EADDRINUSE;
+	return k_object_validate_init(ko, init);
+}
+
+int k_object_find_validate(const void *obj, struct k_object **ko_ptr,
+			   enum k_objects otype, enum _obj_init_check init)
+{
+#ifdef CONFIG_OBJ_VALIDATION_CACHE
+	struct _obj_validation_cache *cache = &_current->obj_cache;
+	unsigned int idx = obj_cache_idx(obj);
+	uint32_t gen = (uint32_t)atomic_get(&obj_cache_gen);
+	struct k_object *ko;
+	int ret;
+
+	if (unlikely(cache->gen != gen)) {
+		(void)memset(cache->entries, 0, sizeof(cache->entries));
+		cache->gen = gen;
+	}
+
+	ko = cache->entries[idx].ko;
+	if (likely((ko != NULL) && (cache->entries[idx].obj == obj) &&
+		   ((otype == K_OBJ_ANY) || (ko->type == otype)))) {
+		/* Permission was granted when the entry was cached, and
+		 * would have been invalidated if since revoked. The object
+		 * type must still match what this call expects, and the
+		 * initialization state can change.
+		 */
+		*ko_ptr = ko;
+		ret = k_object_validate_init(ko, init);
+		if (ret == 0) {
+			return 0;
 		}
 	} else {
-		/* _OBJ_INIT_ANY */
+		ko = k_object_find(obj);
+		*ko_ptr = ko;
 	}
 
-	return 0;
+	ret = k_object_validate(ko, otype, init);
+
+	/* Only cache if nothing was revoked since the permission check
+	 * started, otherwise the entry could outlive the permission.
+	 */
+	if ((ret == 0) && ((uint32_t)atomic_get(&obj_cache_gen) == gen)) {
+		cache->entries[idx].obj = obj;
+		cache->entries[idx].ko = ko;
+	}
+
+	return ret;
+#else
+	*ko_ptr = k_object_find(obj);
+
+	return k_object_validate(*ko_ptr, otype, init);
+#endif /* CONFIG_OBJ_VALIDATION_CACHE */
 }
 
 void k_object_init(const void *obj)
@@ -793,6 +878,7 @@ void k_object_recycle(const void *obj)
 
 	if (ko != NULL) {
 		(void)memset(ko->perms, 0, sizeof(ko->perms));
+		obj_cache_invalidate();
 		k_thread_perms_set(ko, _current);
 		ko->flags |= K_OBJ_FLAG_INITIALIZED;
 	}
@@ -173,6 +173,178 @@ int k_work_busy_get(const struct k_work *work)
 	return ret;
 }
 
+#ifdef CONFIG_WORKQUEUE_WORK_STEALING
+static inline bool queue_has_workers(const struct k_work_q *queue)
+{
+	return queue->workers != NULL;
+}
+
+/* Find the worker of a queue animated by the current thread.
+ *
+ * @retval the worker, or NULL if not invoked from a worker thread of @p
+ * queue.
+ */
+static struct k_work_q_worker *current_worker(struct k_work_q *queue)
+{
+	for (size_t i = 0; i < queue->num_workers; i++) {
+		if (_current == &queue->workers[i].thread) {
+			return &queue->workers[i];
+		}
+	}
+
+	return NULL;
+}
+
+/* Find the worker of a queue that holds or is running a work item.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue with workers
+ * @param work the work item to look for
+ * @param in_list set to true if @p work was found in the pending list of
+ * the returned worker, to false if the worker is running it.
+ *
+ * @retval the worker, or NULL if @p work is neither queued nor running.
+ */
+static struct k_work_q_worker *find_worker_locked(struct k_work_q *queue,
+						  struct k_work *work,
+						  bool *in_list)
+{
+	sys_snode_t *prev;
+
+	for (size_t i = 0; i < queue->num_workers; i++) {
+		struct k_work_q_worker *worker = &queue->workers[i];
+
+		if (sys_slist_find(&worker->pending, &work->node, &prev)) {
+			*in_list = true;
+			return worker;
+		}
+	}
+
+	for (size_t i = 0; i < queue->num_workers; i++) {
+		if (queue->workers[i].current == work) {
+			*in_list = false;
+			return &queue->workers[i];
+		}
+	}
+
+	return NULL;
+}
+
+/* Check whether any worker of a queue is running an item.
+ *
+ * Invoked with work lock held.
+ */
+static bool workers_busy_locked(const struct k_work_q *queue)
+{
+	for (size_t i = 0; i < queue->num_workers; i++) {
+		if (queue->workers[i].current != NULL) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Check whether any worker of a queue has pending items.
+ *
+ * Invoked with work lock held.
+ */
+static bool workers_pending_locked(const struct k_work_q *queue)
+{
+	for (size_t i = 0; i < queue->num_workers; i++) {
+		if (!sys_slist_is_empty(&queue->workers[i].pending)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Wake up a worker to look for work.
+ *
+ * Wake @p worker if it is idle, or any other idle worker so that it
+ * can steal the work.  A busy worker always checks its own list before
+ * going idle, so items are never left behind.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue with workers
+ * @param worker the worker that got new work, or NULL
+ *
+ * @return true if and only if a worker was woken.
+ */
+static bool notify_workers_locked(struct k_work_q *queue,
+				  struct k_work_q_worker *worker)
+{
+	if ((worker != NULL) && z_sched_wake(&worker->notifyq, 0, NULL)) {
+		return true;
+	}
+
+	for (size_t i = 0; i < queue->num_workers; i++) {
+		if (z_sched_wake(&queue->workers[i].notifyq, 0, NULL)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Check whether the item at the head of a worker list may be run by
+ * another worker.
+ *
+ * Flushers must run on the worker holding or running the flushed item,
+ * after it, and an item resubmitted while running must not run
+ * concurrently with itself.  So neither flushers, nor running items,
+ * nor items followed by a flusher can be stolen.
+ */
+static bool work_stealable(struct k_work *work)
+{
+	sys_snode_t *next = sys_slist_peek_next(&work->node);
+
+	if ((flags_get(&work->flags)
+	     & (K_WORK_RUNNING | K_WORK_FLUSHING)) != 0U) {
+		return false;
+	}
+
+	return (next == NULL) ||
+	       !flag_test(&CONTAINER_OF(next, struct k_work, node)->flags,
+			  K_WORK_FLUSHING_BIT);
+}
+
+/* Get the next item for a worker to process: the head of its own list,
+ * or else an item stolen from the head of another worker's list.
+ *
+ * Invoked with work lock held.
+ *
+ * @retval the work item, removed from the list it was found on, or NULL.
+ */
+static struct k_work *worker_next_locked(struct k_work_q_worker *worker)
+{
+	struct k_work_q *queue = worker->queue;
+	size_t self = worker - queue->workers;
+	sys_snode_t *node = sys_slist_get(&worker->pending);
+
+	if (node != NULL) {
+		return CONTAINER_OF(node, struct k_work, node);
+	}
+
+	for (size_t i = 1; i < queue->num_workers; i++) {
+		struct k_work_q_worker *victim =
+			&queue->workers[(self + i) % queue->num_workers];
+
+		node = sys_slist_peek_head(&victim->pending);
+		if ((node != NULL) &&
+		    work_stealable(CONTAINER_OF(node, struct k_work, node))) {
+			(void)sys_slist_get(&victim->pending);
+			return CONTAINER_OF(node, struct k_work, node);
+		}
+	}
+
+	return NULL;
+}
+#endif /* CONFIG_WORKQUEUE_WORK_STEALING */
+
 /* Add a flusher work item to the queue.
  *
  * Invoked with work lock held.
@@ -190,21 +362,36 @@ static void queue_flusher_locked(struct k_work_q *queue,
 {
 	bool in_list = false;
 	struct k_work *wn;
+	sys_slist_t *pending = &queue->pending;
 
-	/* Determine whether the work item is still queued. */
-	SYS_SLIST_FOR_EACH_CONTAINER(&queue->pending, wn, node) {
-		if (wn == work) {
-			in_list = true;
-			break;
+#ifdef CONFIG_WORKQUEUE_WORK_STEALING
+	if (queue_has_workers(queue)) {
+		/* The flusher goes to the worker that holds or runs the
+		 * work item, which won't let other workers steal it.
+		 */
+		struct k_work_q_worker *worker =
+			find_worker_locked(queue, work, &in_list);
+
+		__ASSERT_NO_MSG(worker != NULL);
+		pending = &worker->pending;
+	} else
+#endif /* CONFIG_WORKQUEUE_WORK_STEALING */
+	{
+		/* Determine whether the work item is still queued. */
+		SYS_SLIST_FOR_EACH_CONTAINER(pending, wn, node) {
+			if (wn == work) {
+				in_list = true;
+				break;
+			}
 		}
 	}
 
 	init_flusher(flusher);
 	if (in_list) {
-		sys_slist_insert(&queue->pending, &work->node,
+		sys_slist_insert(pending, &work->node,
 				 &flusher->work.node);
 	} else {
-		sys_slist_prepend(&queue->pending, &flusher->work.node);
+		sys_slist_prepend(pending, &flusher->work.node);
 	}
 }
 
@@ -219,6 +406,17 @@ static inline void queue_remove_locked(struct k_work_q *queue,
 				       struct k_work *work)
 {
 	if (flag_test_and_clear(&work->flags, K_WORK_QUEUED_BIT)) {
+#ifdef CONFIG_WORKQUEUE_WORK_STEALING
+		if (queue_has_workers(queue)) {
+			for (size_t i = 0; i < queue->num_workers; i++) {
+				if (sys_slist_find_and_remove(&queue->workers[i].pending,
+							      &work->node)) {
+					break;
+				}
+			}
+			return;
+		}
+#endif /* CONFIG_WORKQUEUE_WORK_STEALING */
 		(void)sys_slist_find_and_remove(&queue->pending, &work->node);
 	}
 }
@@ -239,6 +437,11 @@ static inline bool notify_queue_locked(struct k_work_q *queue)
 	bool rv = false;
 
 	if (queue != NULL) {
+#ifdef CONFIG_WORKQUEUE_WORK_STEALING
+		if (queue_has_workers(queue)) {
+			return notify_workers_locked(queue, NULL);
+		}
+#endif /* CONFIG_WORKQUEUE_WORK_STEALING */
 		rv = z_sched_wake(&queue->notifyq, 0, NULL);
 	}
 
@@ -273,6 +476,14 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 
 	int ret;
 	bool chained = (_current == &queue->thread) && !k_is_in_isr();
+#ifdef CONFIG_WORKQUEUE_WORK_STEALING
+	struct k_work_q_worker *worker = NULL;
+
+	if (queue_has_workers(queue) && !k_is_in_isr()) {
+		worker = current_worker(queue);
+		chained = (worker != NULL);
+	}
+#endif /* CONFIG_WORKQUEUE_WORK_STEALING */
 	bool draining = flag_test(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 	bool plugged = flag_test(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
 
@@ -289,6 +500,27 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 		ret = -EBUSY;
 	} else if (plugged && !draining) {
 		ret = -EBUSY;
+#ifdef CONFIG_WORKQUEUE_WORK_STEALING
+	} else if (queue_has_workers(queue)) {
+		bool in_list;
+
+		/* A running item goes back to the worker running it, to
+		 * prevent handler re-entrancy.  Otherwise chained work
+		 * stays on the submitting worker, and other work goes to
+		 * the worker of the submitting CPU.
+		 */
+		if (flag_test(&work->flags, K_WORK_RUNNING_BIT)) {
+			worker = find_worker_locked(queue, work, &in_list);
+		} else if (worker == NULL) {
+			worker = &queue->workers[_current_cpu->id %
+						 queue->num_workers];
+		}
+
+		__ASSERT_NO_MSG(worker != NULL);
+		sys_slist_append(&worker->pending, &work->node);
+		ret = 1;
+		(void)notify_workers_locked(queue, worker);
+#endif /* CONFIG_WORKQUEUE_WORK_STEALING */
 	} else {
 		sys_slist_append(&queue->pending, &work->node);
 		ret = 1;
@@ -715,6 +947,84 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 	}
 }
 
+#ifdef CONFIG_WORKQUEUE_WORK_STEALING
+/* Loop executed by a worker thread of a multi-threaded work queue.
+ *
+ * This mirrors work_queue_main(), except that work is taken from the
+ * worker's own list or stolen from other workers, and that the queue is
+ * only busy, or drained, as long as any of its workers is.
+ *
+ * @param worker_ptr pointer to the worker structure
+ */
+static void work_worker_main(void *worker_ptr, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	struct k_work_q_worker *worker = (struct k_work_q_worker *)worker_ptr;
+	struct k_work_q *queue = worker->queue;
+
+	while (true) {
+		struct k_work *work;
+		k_work_handler_t handler = NULL;
+		k_spinlock_key_t key = k_spin_lock(&lock);
+		bool yield;
+
+		work = worker_next_locked(worker);
+		if (work != NULL) {
+			flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+			worker->current = work;
+			flag_set(&work->flags, K_WORK_RUNNING_BIT);
+			flag_clear(&work->flags, K_WORK_QUEUED_BIT);
+			handler = work->handler;
+		} else if (flag_test(&queue->flags, K_WORK_QUEUE_DRAIN_BIT) &&
+			   !workers_busy_locked(queue) &&
+			   !workers_pending_locked(queue)) {
+			/* Last worker to go idle while draining */
+			flag_clear(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
+			(void)z_sched_wake_all(&queue->drainq, 1, NULL);
+		} else {
+			/* No work is available and no queue state requires
+			 * special handling.
+			 */
+			;
+		}
+
+		if (work == NULL) {
+			(void)z_sched_wait(&lock, key, &worker->notifyq,
+					   K_FOREVER, NULL);
+			continue;
+		}
+
+		k_spin_unlock(&lock, key);
+
+		__ASSERT_NO_MSG(handler != NULL);
+		handler(work);
+
+		key = k_spin_lock(&lock);
+
+		worker->current = NULL;
+		flag_clear(&work->flags, K_WORK_RUNNING_BIT);
+		if (flag_test(&work->flags, K_WORK_FLUSHING_BIT)) {
+			finalize_flush_locked(work);
+		}
+		if (flag_test(&work->flags, K_WORK_CANCELING_BIT)) {
+			finalize_cancel_locked(work);
+		}
+
+		if (!workers_busy_locked(queue)) {
+			flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+		}
+		yield = !flag_test(&queue->flags, K_WORK_QUEUE_NO_YIELD_BIT);
+		k_spin_unlock(&lock, key);
+
+		if (yield) {
+			k_yield();
+		}
+	}
+}
+#endif /* CONFIG_WORKQUEUE_WORK_STEALING */
+
 void k_work_queue_init(struct k_work_q *queue)
 {
 	__ASSERT_NO_MSG(queue != NULL);
@@ -770,6 +1080,67 @@ void k_work_queue_start(struct k_work_q *queue,
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
 }
 
+#ifdef CONFIG_WORKQUEUE_WORK_STEALING
+void k_work_queue_start_workers(struct k_work_q *queue,
+				struct k_work_q_worker *workers,
+				size_t num_workers,
+				k_thread_stack_t *stacks, size_t stack_size,
+				int prio, const struct k_work_queue_config *cfg)
+{
+	__ASSERT_NO_MSG(queue);
+	__ASSERT_NO_MSG(workers);
+	__ASSERT_NO_MSG(num_workers > 0);
+	__ASSERT_NO_MSG(stacks);
+	__ASSERT_NO_MSG(!flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT));
+	uint32_t flags = K_WORK_QUEUE_STARTED;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, start, queue);
+
+	z_waitq_init(&queue->drainq);
+	queue->workers = workers;
+	queue->num_workers = num_workers;
+
+	for (size_t i = 0; i < num_workers; i++) {
+		workers[i].queue = queue;
+		workers[i].current = NULL;
+		sys_slist_init(&workers[i].pending);
+		z_waitq_init(&workers[i].notifyq);
+	}
+
+	if ((cfg != NULL) && cfg->no_yield) {
+		flags |= K_WORK_QUEUE_NO_YIELD;
+	}
+
+	flags_set(&queue->flags, flags);
+
+	for (size_t i = 0; i < num_workers; i++) {
+		struct k_thread *thread = &workers[i].thread;
+
+		/* Stacks are laid out as by K_THREAD_STACK_ARRAY_DEFINE() */
+		(void)k_thread_create(thread,
+				      &stacks[i * K_THREAD_STACK_LEN(stack_size)],
+				      stack_size, work_worker_main, &workers[i],
+				      NULL, NULL, prio, 0, K_FOREVER);
+
+		if ((cfg != NULL) && (cfg->name != NULL)) {
+			k_thread_name_set(thread, cfg->name);
+		}
+
+		if ((cfg != NULL) && (cfg->essential)) {
+			thread->base.user_options |= K_ESSENTIAL;
+		}
+
+#ifdef CONFIG_SCHED_CPU_MASK
+		(void)k_thread_cpu_pin(thread, i % arch_num_cpus());
+#endif /* CONFIG_SCHED_CPU_MASK */
+
+		k_thread_start(thread);
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
+}
+#endif /* CONFIG_WORKQUEUE_WORK_STEALING */
+
 int k_work_queue_drain(struct k_work_q *queue,
 		       bool plug)
 {
@@ -781,10 +1152,18 @@ int k_work_queue_drain(struct k_work_q *queue,
 	int ret = 0;
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
+	bool pending = !sys_slist_is_empty(&queue->pending);
+
+#ifdef CONFIG_WORKQUEUE_WORK_STEALING
+	if (queue_has_workers(queue)) {
+		pending = workers_pending_locked(queue);
+	}
+#endif /* CONFIG_WORKQUEUE_WORK_STEALING */
+
 	if (((flags_get(&queue->flags)
 	      & (K_WORK_QUEUE_BUSY | K_WORK_QUEUE_DRAIN)) != 0U)
 	    || plug
-	    || !sys_slist_is_empty(&queue->pending)) {
+	    || pending) {
 		flag_set(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 		if (plug) {
 			flag_set(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
@@ -870,6 +1249,16 @@ void k_work_init_delayable(struct k_work_delayable *dwork,
 	SYS_PORT_TRACING_OBJ_INIT(k_work_delayable, dwork);
 }
 
+void k_work_delayable_slack_set(struct k_work_delayable *dwork,
+				k_timeout_t slack)
+{
+	__ASSERT_NO_MSG(dwork != NULL);
+
+	K_SPINLOCK(&lock) {
+		z_set_timeout_slack(&dwork->timeout, slack);
+	}
+}
+
 static inline int work_delayable_busy_get_locked(const struct k_work_delayable *dwork)
 {
 	return flags_get(&dwork->work.flags) & K_WORK_MASK;
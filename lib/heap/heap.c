@@ -160,6 +160,57 @@ static chunkid_t mem_to_chunkid(struct z_heap *h, void *p)
 	return (mem - chunk_header_bytes(h) - base) / CHUNK_UNIT;
 }
 
+#ifdef CONFIG_SYS_HEAP_SLABS
+static void slab_push(struct z_heap *h, chunkid_t c)
+{
+	struct z_heap_slab *s = &h->slabs[slab_idx(chunk_size(h, c))];
+
+	set_next_free_chunk(h, c, s->free);
+	s->free = c;
+	s->count++;
+}
+
+/* Caches a chunk being freed in its size class, returns false if the
+ * chunk must go back to the chunk allocator instead.
+ */
+static bool slab_free(struct z_heap *h, chunkid_t c)
+{
+	chunksz_t sz = chunk_size(h, c);
+
+	if (!slab_sized(sz) || h->slabs[slab_idx(sz)].count >= SLAB_CACHE_MAX) {
+		return false;
+	}
+
+	slab_push(h, c);
+	return true;
+}
+
+/* Returns all cached objects to the chunk allocator, so they can merge
+ * back into bigger free chunks.  Only done when an allocation failed,
+ * the cost is bounded by SLAB_CLASSES * SLAB_CACHE_MAX.
+ */
+static bool slab_release(struct z_heap *h)
+{
+	bool released = false;
+
+	for (int i = 0; i < SLAB_CLASSES; i++) {
+		struct z_heap_slab *s = &h->slabs[i];
+
+		while (s->free != 0U) {
+			chunkid_t c = s->free;
+
+			s->free = next_free_chunk(h, c);
+			s->count--;
+			set_chunk_used(h, c, false);
+			free_chunk(h, c);
+			released = true;
+		}
+	}
+
+	return released;
+}
+#endif
+
 void sys_heap_free(struct sys_heap *heap, void *mem)
 {
 	if (mem == NULL) {
@@ -184,7 +235,6 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 		 "corrupted heap bounds (buffer overflow?) for memory at %p",
 		 mem);
 
-	set_chunk_used(h, c, false);
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	h->allocated_bytes -= chunksz_to_bytes(h, chunk_size(h, c));
 #endif
@@ -194,6 +244,13 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 				  chunksz_to_bytes(h, chunk_size(h, c)));
 #endif
 
+#ifdef CONFIG_SYS_HEAP_SLABS
+	if (slab_free(h, c)) {
+		return;
+	}
+#endif
+
+	set_chunk_used(h, c, false);
 	free_chunk(h, c);
 }
 
@@ -260,6 +317,57 @@ static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
 	return 0;
 }
 
+#ifdef CONFIG_SYS_HEAP_SLABS
+/* Carves a run of CONFIG_SYS_HEAP_SLAB_OBJECTS adjacent objects out of
+ * a single free chunk, keeping small allocations packed together
+ * rather than splitting them off bigger free chunks one at a time.
+ * The first object is returned, the others are cached.
+ */
+static chunkid_t slab_refill(struct z_heap *h, chunksz_t sz)
+{
+	chunksz_t run_sz = sz * CONFIG_SYS_HEAP_SLAB_OBJECTS;
+	chunkid_t c = alloc_chunk(h, run_sz);
+
+	if (c == 0U) {
+		return 0;
+	}
+
+	if (chunk_size(h, c) > run_sz) {
+		split_chunks(h, c, c + run_sz);
+		free_list_add(h, c + run_sz);
+	}
+
+	for (chunkid_t o = c + run_sz - sz; o > c; o -= sz) {
+		split_chunks(h, c, o);
+		set_chunk_used(h, o, true);
+		slab_push(h, o);
+	}
+
+	return c;
+}
+
+/* Allocates a chunk of exactly @a sz units, which must be a slab size
+ * class.  Cached objects are handed out in constant time; when the
+ * class is empty a new run is carved, falling back to a single chunk
+ * if the heap can't fit a whole run.
+ */
+static chunkid_t slab_alloc(struct z_heap *h, chunksz_t sz)
+{
+	struct z_heap_slab *s = &h->slabs[slab_idx(sz)];
+	chunkid_t c = s->free;
+
+	if (c != 0U) {
+		s->free = next_free_chunk(h, c);
+		s->count--;
+		return c;
+	}
+
+	c = slab_refill(h, sz);
+
+	return (c != 0U) ? c : alloc_chunk(h, sz);
+}
+#endif
+
 void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 {
 	struct z_heap *h = heap->heap;
@@ -270,7 +378,21 @@ void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 	}
 
 	chunksz_t chunk_sz = bytes_to_chunksz(h, bytes);
-	chunkid_t c = alloc_chunk(h, chunk_sz);
+	chunkid_t c;
+
+#ifdef CONFIG_SYS_HEAP_SLABS
+	if (bytes <= CONFIG_SYS_HEAP_SLAB_MAX_SIZE) {
+		chunk_sz = slab_chunksz(slab_idx(chunk_sz));
+		c = slab_alloc(h, chunk_sz);
+	} else {
+		c = alloc_chunk(h, chunk_sz);
+	}
+	if (c == 0U && slab_release(h)) {
+		c = alloc_chunk(h, chunk_sz);
+	}
+#else
+	c = alloc_chunk(h, chunk_sz);
+#endif
 	if (c == 0U) {
 		return NULL;
 	}
@@ -335,6 +457,11 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 	chunksz_t padded_sz = bytes_to_chunksz(h, bytes + align - gap);
 	chunkid_t c0 = alloc_chunk(h, padded_sz);
 
+#ifdef CONFIG_SYS_HEAP_SLABS
+	if (c0 == 0 && slab_release(h)) {
+		c0 = alloc_chunk(h, padded_sz);
+	}
+#endif
 	if (c0 == 0) {
 		return NULL;
 	}
@@ -527,6 +654,13 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 		h->buckets[i].next = 0;
 	}
 
+#ifdef CONFIG_SYS_HEAP_SLABS
+	for (int i = 0; i < SLAB_CLASSES; i++) {
+		h->slabs[i].free = 0;
+		h->slabs[i].count = 0;
+	}
+#endif
+
 	/* chunk containing our struct z_heap */
 	set_chunk_size(h, 0, chunk0_size);
 	set_left_chunk_size(h, 0, 0);
@@ -65,6 +65,26 @@ struct z_heap_bucket {
 	chunkid_t next;
 };
 
+#ifdef CONFIG_SYS_HEAP_SLABS
+/* The slab front end keeps a LIFO list of cached objects per size
+ * class.  Size classes are spaced two chunk units (16 bytes) apart,
+ * class N holding chunks of 2 * (N + 1) units.  Cached objects remain
+ * regular chunks marked "used", so they never merge with their
+ * neighbors until released back to the chunk allocator.  The list is
+ * linked through the FREE_NEXT field, which lies in the chunk's user
+ * memory.
+ */
+#define SLAB_CLASS_UNITS 2U
+#define SLAB_CLASSES SYS_HEAP_SLAB_CLASSES
+#define SLAB_MAX_CHUNKS (SLAB_CLASSES * SLAB_CLASS_UNITS)
+#define SLAB_CACHE_MAX (2U * CONFIG_SYS_HEAP_SLAB_OBJECTS)
+
+struct z_heap_slab {
+	chunkid_t free;
+	uint32_t count;
+};
+#endif
+
 struct z_heap {
 	chunkid_t chunk0_hdr[2];
 	chunkid_t end_chunk;
@@ -73,6 +93,9 @@ struct z_heap {
 	size_t free_bytes;
 	size_t allocated_bytes;
 	size_t max_allocated_bytes;
+#endif
+#ifdef CONFIG_SYS_HEAP_SLABS
+	struct z_heap_slab slabs[SLAB_CLASSES];
 #endif
 	struct z_heap_bucket buckets[0];
 };
@@ -262,6 +285,24 @@ static inline bool size_too_big(struct z_heap *h, size_t bytes)
 	return (bytes / CHUNK_UNIT) >= h->end_chunk;
 }
 
+#ifdef CONFIG_SYS_HEAP_SLABS
+static inline int slab_idx(chunksz_t sz)
+{
+	return (sz - 1U) / SLAB_CLASS_UNITS;
+}
+
+static inline chunksz_t slab_chunksz(int idx)
+{
+	return (idx + 1) * SLAB_CLASS_UNITS;
+}
+
+/* Whether a chunk of this size can be cached by the slab front end */
+static inline bool slab_sized(chunksz_t sz)
+{
+	return sz <= SLAB_MAX_CHUNKS && (sz % SLAB_CLASS_UNITS) == 0U;
+}
+#endif
+
 static inline void get_alloc_info(struct z_heap *h, size_t *alloc_bytes,
 			   size_t *free_bytes)
 {
@@ -277,6 +318,14 @@ static inline void get_alloc_info(struct z_heap *h, size_t *alloc_bytes,
 			*free_bytes += chunksz_to_bytes(h, chunk_size(h, c));
 		}
 	}
+
+#ifdef CONFIG_SYS_HEAP_SLABS
+	/* Cached slab objects look used but are not allocated */
+	for (int i = 0; i < SLAB_CLASSES; i++) {
+		*alloc_bytes -= h->slabs[i].count *
+				chunksz_to_bytes(h, slab_chunksz(i));
+	}
+#endif
 }
 
 #endif /* ZEPHYR_INCLUDE_LIB_OS_HEAP_H_ */
@@ -85,6 +85,25 @@ bool sys_heap_validate(struct sys_heap *heap)
 		return false;  /* Should have exactly consumed the buffer */
 	}
 
+#ifdef CONFIG_SYS_HEAP_SLABS
+	/* Cached slab objects must be used chunks of their class size */
+	for (int i = 0; i < SLAB_CLASSES; i++) {
+		uint32_t n = 0;
+
+		for (c = h->slabs[i].free; c != 0; c = next_free_chunk(h, c)) {
+			if (!valid_chunk(h, c) || !chunk_used(h, c) ||
+			    chunk_size(h, c) != slab_chunksz(i) ||
+			    ++n > h->slabs[i].count) {
+				return false;
+			}
+		}
+
+		if (n != h->slabs[i].count) {
+			return false;
+		}
+	}
+#endif
+
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	/*
 	 * Validate sys_heap_runtime_stats_get API.
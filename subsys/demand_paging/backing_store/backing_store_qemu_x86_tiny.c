@@ -67,6 +67,17 @@ void k_mem_paging_backing_store_page_in(uintptr_t location)
 		     CONFIG_MMU_PAGE_SIZE);
 }
 
+void k_mem_paging_backing_store_page_in_batch(struct z_page_frame **pfs,
+					      uintptr_t *locations,
+					      size_t count)
+{
+	for (size_t i = 0; i < count; i++) {
+		arch_mem_scratch(z_page_frame_to_phys(pfs[i]));
+		(void)memcpy(Z_SCRATCH_PAGE, location_to_flash(locations[i]),
+			     CONFIG_MMU_PAGE_SIZE);
+	}
+}
+
 void k_mem_paging_backing_store_page_finalize(struct z_page_frame *pf,
 					      uintptr_t location)
 {
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Aging (LRU approximation) eviction algorithm for demand paging
+ */
+#include <zephyr/kernel.h>
+#include <mmu.h>
+#include <kernel_arch_interface.h>
+
+#include <zephyr/kernel/mm/demand_paging.h>
+
+/* Each page frame has an 8-bit age. A periodic timer shifts every age
+ * right by one bit and moves the accessed bit of the page into the top
+ * bit, clearing it in the page tables. The age thus records whether the
+ * page was used in each of the last eight periods, most recent first,
+ * and comparing ages as integers orders pages by how recently they
+ * were used.
+ *
+ * When a page frame needs to be evicted, the one with the lowest age is
+ * chosen. A page accessed since the last update ranks above any age,
+ * and between pages of equal age the clean one is preferred, as it
+ * need not be written to the backing store.
+ */
+static uint8_t page_ages[Z_NUM_PAGE_FRAMES];
+
+static void aging_periodic_update(struct k_timer *timer)
+{
+	uintptr_t phys, flags;
+	struct z_page_frame *pf;
+	unsigned int key = irq_lock();
+
+	Z_PAGE_FRAME_FOREACH(phys, pf) {
+		uint8_t *age = &page_ages[pf - z_page_frames];
+
+		if (!z_page_frame_is_evictable(pf)) {
+			/* Forget the history of unmapped and pinned page
+			 * frames, so whatever is loaded in them next starts
+			 * out fresh.
+			 */
+			*age = 0U;
+			continue;
+		}
+
+		/* Fetch the state and clear the accessed bit in one go */
+		flags = arch_page_info_get(z_page_frame_to_virt(pf), NULL, true);
+
+		*age >>= 1;
+		if ((flags & ARCH_DATA_PAGE_ACCESSED) != 0UL) {
+			*age |= BIT(7);
+		}
+	}
+
+	irq_unlock(key);
+}
+
+struct z_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	unsigned int last_prec = UINT_MAX;
+	struct z_page_frame *last_pf = NULL, *pf;
+	bool accessed;
+	bool last_dirty = false;
+	bool dirty = false;
+	uintptr_t flags, phys;
+
+	Z_PAGE_FRAME_FOREACH(phys, pf) {
+		unsigned int prec;
+
+		if (!z_page_frame_is_evictable(pf)) {
+			continue;
+		}
+
+		flags = arch_page_info_get(z_page_frame_to_virt(pf), NULL, false);
+		accessed = (flags & ARCH_DATA_PAGE_ACCESSED) != 0UL;
+		dirty = (flags & ARCH_DATA_PAGE_DIRTY) != 0UL;
+
+		/* Implies a mismatch with page frame ontology and page
+		 * tables
+		 */
+		__ASSERT((flags & ARCH_DATA_PAGE_LOADED) != 0U,
+			 "non-present page, %s",
+			 ((flags & ARCH_DATA_PAGE_NOT_MAPPED) != 0U) ?
+			 "un-mapped" : "paged out");
+
+		prec = ((accessed ? BIT(8) : 0U) | page_ages[pf - z_page_frames]) << 1;
+		prec |= dirty ? 1U : 0U;
+		if (prec == 0) {
+			/* Not used for eight periods and clean, we're done */
+			last_pf = pf;
+			last_dirty = dirty;
+			break;
+		}
+
+		if (prec < last_prec) {
+			last_prec = prec;
+			last_pf = pf;
+			last_dirty = dirty;
+		}
+	}
+	/* Shouldn't ever happen unless every page is pinned */
+	__ASSERT(last_pf != NULL, "no page to evict");
+
+	/* The next page loaded in this frame has no history */
+	page_ages[last_pf - z_page_frames] = 0U;
+
+	*dirty_ptr = last_dirty;
+
+	return last_pf;
+}
+
+static K_TIMER_DEFINE(aging_timer, aging_periodic_update, NULL);
+
+void k_mem_paging_eviction_init(void)
+{
+	k_timer_start(&aging_timer, K_NO_WAIT,
+		      K_MSEC(CONFIG_EVICTION_AGING_PERIOD));
+}
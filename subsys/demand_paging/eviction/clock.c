@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * CLOCK (second chance) eviction algorithm for demand paging
+ */
+#include <zephyr/kernel.h>
+#include <mmu.h>
+#include <kernel_arch_interface.h>
+
+#include <zephyr/kernel/mm/demand_paging.h>
+
+/* The page frames form a circular list with a single hand pointing at
+ * the next eviction candidate. When a page frame needs to be evicted,
+ * the hand sweeps forward: a page frame whose accessed bit is set gets
+ * a second chance, the bit being cleared as the hand passes over it,
+ * and the first page frame found with the accessed bit clear is
+ * evicted. The hand is left just past the evicted page frame, so the
+ * next selection resumes where this one stopped instead of rescanning
+ * all of RAM.
+ *
+ * No periodic timer is needed; the sweep itself ages the pages. Since
+ * the first full revolution clears every accessed bit, a victim is
+ * always found within two revolutions.
+ */
+static size_t clock_hand;
+
+struct z_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	struct z_page_frame *pf;
+	uintptr_t flags;
+
+	for (size_t i = 0; i < 2 * Z_NUM_PAGE_FRAMES; i++) {
+		pf = &z_page_frames[clock_hand];
+
+		clock_hand++;
+		if (clock_hand == Z_NUM_PAGE_FRAMES) {
+			clock_hand = 0;
+		}
+
+		if (!z_page_frame_is_evictable(pf)) {
+			continue;
+		}
+
+		/* Fetch the state and clear the accessed bit in one go */
+		flags = arch_page_info_get(z_page_frame_to_virt(pf), NULL, true);
+
+		/* Implies a mismatch with page frame ontology and page
+		 * tables
+		 */
+		__ASSERT((flags & ARCH_DATA_PAGE_LOADED) != 0U,
+			 "non-present page, %s",
+			 ((flags & ARCH_DATA_PAGE_NOT_MAPPED) != 0U) ?
+			 "un-mapped" : "paged out");
+
+		if ((flags & ARCH_DATA_PAGE_ACCESSED) != 0UL) {
+			/* Second chance */
+			continue;
+		}
+
+		*dirty_ptr = (flags & ARCH_DATA_PAGE_DIRTY) != 0UL;
+
+		return pf;
+	}
+
+	/* Shouldn't ever happen unless every page is pinned */
+	__ASSERT(false, "no page to evict");
+
+	return NULL;
+}
+
+void k_mem_paging_eviction_init(void)
+{
+	/* Nothing to do */
+}
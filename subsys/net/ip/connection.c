@@ -116,6 +116,96 @@ void conn_register_debug(struct net_conn *conn,
 
 static K_MUTEX_DEFINE(conn_lock);
 
+#if defined(CONFIG_NET_CONN_HASH)
+/* UDP and TCP connections are also indexed in a hash table, so that
+ * received unicast packets are only matched against a few of them.
+ * Connections with a remote address and port are hashed on (proto,
+ * local port, remote address, remote port), the others with a local
+ * port on (proto, local port), and the ones without a local port are
+ * kept on a wildcard chain searched for every packet.
+ */
+static sys_slist_t conn_hash[CONFIG_NET_CONN_HASH_SIZE];
+static sys_slist_t conn_wildcard;
+static uint32_t conn_seq;
+
+static inline uint32_t conn_hash_mix(uint32_t hash, uint32_t value)
+{
+	return (hash ^ value) * 0x9e3779b1U;
+}
+
+/* Ports are in network byte order, the address may be unaligned */
+static sys_slist_t *conn_hash_chain(uint16_t proto, uint16_t local_port,
+				    const uint8_t *remote_addr, size_t addr_len,
+				    uint16_t remote_port)
+{
+	uint32_t hash = conn_hash_mix(proto, local_port);
+
+	for (size_t i = 0; i < addr_len; i += sizeof(uint32_t)) {
+		hash = conn_hash_mix(hash, UNALIGNED_GET((const uint32_t *)&remote_addr[i]));
+	}
+
+	if (remote_addr != NULL) {
+		hash = conn_hash_mix(hash, remote_port);
+	}
+
+	return &conn_hash[(hash ^ (hash >> 16)) % CONFIG_NET_CONN_HASH_SIZE];
+}
+
+static bool conn_is_hashed(struct net_conn *conn)
+{
+	return (conn->proto == IPPROTO_UDP || conn->proto == IPPROTO_TCP) &&
+	       (conn->family == AF_INET || conn->family == AF_INET6 ||
+		conn->family == AF_UNSPEC);
+}
+
+/* The chain a connection belongs to, given its current addresses */
+static sys_slist_t *conn_chain(struct net_conn *conn)
+{
+	uint16_t local_port = net_sin(&conn->local_addr)->sin_port;
+	uint16_t remote_port = net_sin(&conn->remote_addr)->sin_port;
+
+	if (local_port == 0U) {
+		return &conn_wildcard;
+	}
+
+	if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) &&
+	    (conn->flags & NET_CONN_REMOTE_ADDR_SPEC) && remote_port != 0U) {
+		if (IS_ENABLED(CONFIG_NET_IPV6) &&
+		    conn->remote_addr.sa_family == AF_INET6) {
+			return conn_hash_chain(conn->proto, local_port,
+					       net_sin6(&conn->remote_addr)->sin6_addr.s6_addr,
+					       sizeof(struct in6_addr), remote_port);
+		} else if (IS_ENABLED(CONFIG_NET_IPV4) &&
+			   conn->remote_addr.sa_family == AF_INET) {
+			return conn_hash_chain(conn->proto, local_port,
+					       net_sin(&conn->remote_addr)->sin_addr.s4_addr,
+					       sizeof(struct in_addr), remote_port);
+		}
+	}
+
+	return conn_hash_chain(conn->proto, local_port, NULL, 0, 0);
+}
+
+/* Called with conn_lock held */
+static void conn_hash_add(struct net_conn *conn)
+{
+	if (conn_is_hashed(conn)) {
+		sys_slist_prepend(conn_chain(conn), &conn->hash_node);
+	}
+}
+
+/* Called with conn_lock held */
+static void conn_hash_del(struct net_conn *conn)
+{
+	if (conn_is_hashed(conn)) {
+		sys_slist_find_and_remove(conn_chain(conn), &conn->hash_node);
+	}
+}
+#else
+#define conn_hash_add(...)
+#define conn_hash_del(...)
+#endif /* CONFIG_NET_CONN_HASH */
+
 static struct net_conn *conn_get_unused(void)
 {
 	sys_snode_t *node;
@@ -141,6 +231,10 @@ static void conn_set_used(struct net_conn *conn)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_prepend(&conn_used, &conn->node);
+#if defined(CONFIG_NET_CONN_HASH)
+	conn->seq = conn_seq++;
+#endif
+	conn_hash_add(conn);
 	k_mutex_unlock(&conn_lock);
 }
 
@@ -452,6 +546,7 @@ int net_conn_unregister(struct net_conn_handle *handle)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_find_and_remove(&conn_used, &conn->node);
+	conn_hash_del(conn);
 	k_mutex_unlock(&conn_lock);
 
 	conn_set_unused(conn);
@@ -478,7 +573,12 @@ int net_conn_update(struct net_conn_handle *handle,
 
 	net_conn_change_callback(conn, cb, user_data);
 
+	/* The remote end decides which hash chain the connection is on */
+	k_mutex_lock(&conn_lock, K_FOREVER);
+	conn_hash_del(conn);
 	ret = net_conn_change_remote(conn, remote_addr, remote_port);
+	conn_hash_add(conn);
+	k_mutex_unlock(&conn_lock);
 
 	return ret;
 }
@@ -534,6 +634,150 @@ static bool conn_addr_cmp(struct net_pkt *pkt,
 	return true;
 }
 
+/* Is the TCP/UDP connection matching the packet's addresses and ports? */
+static bool conn_addr_port_match(struct net_pkt *pkt,
+				 union net_ip_header *ip_hdr,
+				 struct net_conn *conn,
+				 uint16_t src_port, uint16_t dst_port)
+{
+	if (net_sin(&conn->remote_addr)->sin_port &&
+	    net_sin(&conn->remote_addr)->sin_port != src_port) {
+		return false; /* wrong remote port */
+	}
+
+	if (net_sin(&conn->local_addr)->sin_port &&
+	    net_sin(&conn->local_addr)->sin_port != dst_port) {
+		return false; /* wrong local port */
+	}
+
+	if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) &&
+	    !conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
+		return false; /* wrong remote address */
+	}
+
+	if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) &&
+	    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
+
+		/* Check if we could do a v4-mapping-to-v6 and the IPv6 socket
+		 * has no IPV6_V6ONLY option set and if the local IPV6 address
+		 * is unspecified, then we could accept a connection from IPv4
+		 * address by mapping it to IPv6 address.
+		 */
+		if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
+			if (!(conn->family == AF_INET6 && net_pkt_family(pkt) == AF_INET &&
+			      !conn->v6only &&
+			      net_ipv6_is_addr_unspecified(
+				      &net_sin6(&conn->local_addr)->sin6_addr))) {
+				return false; /* wrong local address */
+			}
+		} else {
+			return false; /* wrong local address */
+		}
+
+		/* We might have a match for v4-to-v6 mapping,
+		 * continue with rank checking.
+		 */
+	}
+
+	return true;
+}
+
+#if defined(CONFIG_NET_CONN_HASH)
+static bool conn_hash_usable(uint8_t pkt_family, uint8_t proto, bool is_mcast_pkt)
+{
+	return !is_mcast_pkt &&
+	       (pkt_family == AF_INET || pkt_family == AF_INET6) &&
+	       (proto == IPPROTO_UDP || proto == IPPROTO_TCP);
+}
+
+/* Finds the best matching connection for a unicast TCP/UDP packet, as
+ * the full connection list walk in net_conn_input() would, looking
+ * only at the chains a match can be on.  Called with conn_lock held.
+ */
+static struct net_conn *conn_hash_lookup(struct net_pkt *pkt,
+					 union net_ip_header *ip_hdr,
+					 uint8_t proto,
+					 uint16_t src_port, uint16_t dst_port)
+{
+	uint8_t pkt_family = net_pkt_family(pkt);
+	struct net_conn *best_match = NULL;
+	int16_t best_rank = -1;
+	sys_slist_t *chains[3];
+	struct net_conn *conn;
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && pkt_family == AF_INET6) {
+		chains[0] = conn_hash_chain(proto, dst_port, ip_hdr->ipv6->src,
+					    sizeof(struct in6_addr), src_port);
+	} else {
+		chains[0] = conn_hash_chain(proto, dst_port, ip_hdr->ipv4->src,
+					    sizeof(struct in_addr), src_port);
+	}
+	chains[1] = conn_hash_chain(proto, dst_port, NULL, 0, 0);
+	chains[2] = &conn_wildcard;
+
+	for (int i = 0; i < ARRAY_SIZE(chains); i++) {
+		if (i == 1 && chains[1] == chains[0]) {
+			continue;
+		}
+
+		SYS_SLIST_FOR_EACH_CONTAINER(chains[i], conn, hash_node) {
+			if (conn->context != NULL &&
+			    net_context_is_bound_to_iface(conn->context) &&
+			    net_pkt_iface(pkt) != net_context_get_iface(conn->context)) {
+				continue; /* wrong interface */
+			}
+
+			if (conn->family != AF_UNSPEC && conn->family != pkt_family &&
+			    !(IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6) &&
+			      conn->family == AF_INET6 && pkt_family == AF_INET &&
+			      !conn->v6only)) {
+				continue; /* wrong protocol family */
+			}
+
+			if (conn->proto != proto ||
+			    !conn_addr_port_match(pkt, ip_hdr, conn, src_port, dst_port)) {
+				continue;
+			}
+
+			/* The list walk keeps the first, i.e. newest, of
+			 * equally ranked connections.
+			 */
+			if (best_rank < NET_CONN_RANK(conn->flags) ||
+			    (best_rank == NET_CONN_RANK(conn->flags) &&
+			     (int32_t)(conn->seq - best_match->seq) > 0)) {
+				best_rank = NET_CONN_RANK(conn->flags);
+				best_match = conn;
+			}
+		}
+	}
+
+	return best_match;
+}
+#else
+static inline bool conn_hash_usable(uint8_t pkt_family, uint8_t proto, bool is_mcast_pkt)
+{
+	ARG_UNUSED(pkt_family);
+	ARG_UNUSED(proto);
+	ARG_UNUSED(is_mcast_pkt);
+
+	return false;
+}
+
+static inline struct net_conn *conn_hash_lookup(struct net_pkt *pkt,
+						union net_ip_header *ip_hdr,
+						uint8_t proto,
+						uint16_t src_port, uint16_t dst_port)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(ip_hdr);
+	ARG_UNUSED(proto);
+	ARG_UNUSED(src_port);
+	ARG_UNUSED(dst_port);
+
+	return NULL;
+}
+#endif /* CONFIG_NET_CONN_HASH */
+
 static inline void conn_send_icmp_error(struct net_pkt *pkt)
 {
 	if (IS_ENABLED(CONFIG_NET_DISABLE_ICMP_DESTINATION_UNREACHABLE)) {
@@ -700,6 +944,11 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
+	if (conn_hash_usable(pkt_family, proto, is_mcast_pkt)) {
+		best_match = conn_hash_lookup(pkt, ip_hdr, proto, src_port, dst_port);
+		goto found;
+	}
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
 		/* Is the candidate connection matching the packet's interface? */
 		if (conn->context != NULL &&
@@ -788,43 +1037,8 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 			/* Is the candidate connection matching the packet's TCP/UDP
 			 * address and port?
 			 */
-			if (net_sin(&conn->remote_addr)->sin_port &&
-			    net_sin(&conn->remote_addr)->sin_port != src_port) {
-				continue; /* wrong remote port */
-			}
-
-			if (net_sin(&conn->local_addr)->sin_port &&
-			    net_sin(&conn->local_addr)->sin_port != dst_port) {
-				continue; /* wrong local port */
-			}
-
-			if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
-				continue; /* wrong remote address */
-			}
-
-			if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
-
-				/* Check if we could do a v4-mapping-to-v6 and the IPv6 socket
-				 * has no IPV6_V6ONLY option set and if the local IPV6 address
-				 * is unspecified, then we could accept a connection from IPv4
-				 * address by mapping it to IPv6 address.
-				 */
-				if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
-					if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
-					      !conn->v6only &&
-					      net_ipv6_is_addr_unspecified(
-						      &net_sin6(&conn->local_addr)->sin6_addr))) {
-						continue; /* wrong local address */
-					}
-				} else {
-					continue; /* wrong local address */
-				}
-
-				/* We might have a match for v4-to-v6 mapping,
-				 * continue with rank checking.
-				 */
+			if (!conn_addr_port_match(pkt, ip_hdr, conn, src_port, dst_port)) {
+				continue;
 			}
 
 			if (best_rank < NET_CONN_RANK(conn->flags)) {
@@ -868,6 +1082,7 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		}
 	} /* loop end */
 
+found:
 	if (best_match) {
 		cb = best_match->cb;
 		user_data = best_match->user_data;
@@ -954,6 +1169,13 @@ void net_conn_init(void)
 
 	sys_slist_init(&conn_unused);
 	sys_slist_init(&conn_used);
+#if defined(CONFIG_NET_CONN_HASH)
+	sys_slist_init(&conn_wildcard);
+
+	for (i = 0; i < ARRAY_SIZE(conn_hash); i++) {
+		sys_slist_init(&conn_hash[i]);
+	}
+#endif
 
 	for (i = 0; i < CONFIG_NET_MAX_CONN; i++) {
 		sys_slist_prepend(&conn_unused, &conns[i].node);
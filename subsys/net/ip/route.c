@@ -267,15 +267,290 @@ static inline void update_route_access(struct net_route_entry *route)
 	sys_slist_prepend(&routes, &route->node);
 }
 
-struct net_route_entry *net_route_lookup(struct net_if *iface,
-					 struct in6_addr *dst)
+#if defined(CONFIG_NET_ROUTE_LPM_TRIE)
+/* Path compressed binary trie of the route prefixes. Every node holds
+ * a prefix, the routes that have exactly that prefix (possibly none)
+ * and the subtries for the two values of the bit that follows it.
+ * Nodes without routes are only kept where two subtries branch off, so
+ * at most two nodes are needed per route.
+ */
+struct route_trie_node {
+	struct route_trie_node *child[2];
+	sys_slist_t routes;
+	struct in6_addr prefix;
+	uint8_t prefix_len;
+};
+
+static struct route_trie_node route_trie_nodes[2 * CONFIG_NET_MAX_ROUTES];
+static struct route_trie_node *route_trie_free;
+static struct route_trie_node *route_trie_root;
+
+#if CONFIG_NET_ROUTE_CACHE_SIZE > 0
+/* Recently looked up destinations and their route. Only successful
+ * lookups are cached, and any change to the table flushes the cache.
+ */
+static struct route_cache_entry {
+	struct net_route_entry *route;
+	struct net_if *iface;
+	struct in6_addr dst;
+} route_cache[CONFIG_NET_ROUTE_CACHE_SIZE];
+
+static struct route_cache_entry *route_cache_slot(struct net_if *iface,
+						  const struct in6_addr *dst)
+{
+	uint32_t hash = POINTER_TO_UINT(iface);
+
+	for (int i = 0; i < 4; i++) {
+		hash = hash * 31U + UNALIGNED_GET(&dst->s6_addr32[i]);
+	}
+
+	return &route_cache[(hash ^ (hash >> 16)) % CONFIG_NET_ROUTE_CACHE_SIZE];
+}
+
+static struct net_route_entry *route_cache_get(struct net_if *iface,
+					       const struct in6_addr *dst)
+{
+	struct route_cache_entry *entry = route_cache_slot(iface, dst);
+
+	if (entry->route == NULL || entry->iface != iface ||
+	    !net_ipv6_addr_cmp(&entry->dst, dst)) {
+		return NULL;
+	}
+
+	return entry->route;
+}
+
+static void route_cache_put(struct net_if *iface, const struct in6_addr *dst,
+			    struct net_route_entry *route)
+{
+	struct route_cache_entry *entry = route_cache_slot(iface, dst);
+
+	entry->route = route;
+	entry->iface = iface;
+	net_ipaddr_copy(&entry->dst, dst);
+}
+
+static void route_cache_flush(void)
+{
+	memset(route_cache, 0, sizeof(route_cache));
+}
+#else
+#define route_cache_get(...) NULL
+#define route_cache_put(...)
+#define route_cache_flush(...)
+#endif /* CONFIG_NET_ROUTE_CACHE_SIZE > 0 */
+
+static inline int prefix_bit(const struct in6_addr *addr, uint8_t bit)
+{
+	return (addr->s6_addr[bit / 8U] >> (7U - bit % 8U)) & 1;
+}
+
+/* Number of leading bits, up to max, that two addresses have in common */
+static uint8_t common_prefix_len(const struct in6_addr *a,
+				 const struct in6_addr *b, uint8_t max)
+{
+	uint8_t len = 0U;
+
+	for (int i = 0; i < 16 && len < max; i++) {
+		uint8_t diff = a->s6_addr[i] ^ b->s6_addr[i];
+
+		if (diff != 0U) {
+			len += __builtin_clz(diff) - 24;
+			break;
+		}
+
+		len += 8U;
+	}
+
+	return MIN(len, max);
+}
+
+static struct route_trie_node *route_trie_node_alloc(const struct in6_addr *prefix,
+						     uint8_t prefix_len)
+{
+	struct route_trie_node *node = route_trie_free;
+
+	if (node == NULL) {
+		return NULL;
+	}
+
+	route_trie_free = node->child[0];
+
+	node->child[0] = NULL;
+	node->child[1] = NULL;
+	sys_slist_init(&node->routes);
+	net_ipaddr_copy(&node->prefix, prefix);
+	node->prefix_len = prefix_len;
+
+	return node;
+}
+
+static void route_trie_node_free(struct route_trie_node *node)
+{
+	node->child[0] = route_trie_free;
+	route_trie_free = node;
+}
+
+static int route_trie_add(struct net_route_entry *route)
+{
+	struct route_trie_node **link = &route_trie_root;
+	struct route_trie_node *node, *leaf, *branch;
+	uint8_t len = route->prefix_len;
+	uint8_t common = 0U;
+
+	route_cache_flush();
+
+	while ((node = *link) != NULL) {
+		common = common_prefix_len(&node->prefix, &route->addr,
+					   MIN(node->prefix_len, len));
+		if (common < node->prefix_len) {
+			break;
+		}
+
+		if (common == len) {
+			sys_slist_prepend(&node->routes, &route->trie_node);
+			return 0;
+		}
+
+		link = &node->child[prefix_bit(&route->addr, common)];
+	}
+
+	leaf = route_trie_node_alloc(&route->addr, len);
+	if (leaf == NULL) {
+		return -ENOMEM;
+	}
+
+	sys_slist_prepend(&leaf->routes, &route->trie_node);
+
+	if (node == NULL) {
+		*link = leaf;
+		return 0;
+	}
+
+	/* The new prefix covers the node, so it goes above it */
+	if (common == len) {
+		leaf->child[prefix_bit(&node->prefix, len)] = node;
+		*link = leaf;
+		return 0;
+	}
+
+	/* The prefixes diverge, branch at the first differing bit */
+	branch = route_trie_node_alloc(&route->addr, common);
+	if (branch == NULL) {
+		route_trie_node_free(leaf);
+		return -ENOMEM;
+	}
+
+	branch->child[prefix_bit(&route->addr, common)] = leaf;
+	branch->child[prefix_bit(&node->prefix, common)] = node;
+	*link = branch;
+
+	return 0;
+}
+
+/* Drop the node if it no longer holds routes nor branches */
+static void route_trie_compact(struct route_trie_node **link)
+{
+	struct route_trie_node *node = *link;
+
+	if (!sys_slist_is_empty(&node->routes) ||
+	    (node->child[0] != NULL && node->child[1] != NULL)) {
+		return;
+	}
+
+	*link = node->child[0] != NULL ? node->child[0] : node->child[1];
+	route_trie_node_free(node);
+}
+
+static void route_trie_del(struct net_route_entry *route)
+{
+	struct route_trie_node **link = &route_trie_root;
+	struct route_trie_node **parent = NULL;
+	struct route_trie_node *node;
+	uint8_t len = route->prefix_len;
+
+	route_cache_flush();
+
+	while ((node = *link) != NULL) {
+		if (node->prefix_len > len ||
+		    common_prefix_len(&node->prefix, &route->addr,
+				      node->prefix_len) < node->prefix_len) {
+			return;
+		}
+
+		if (node->prefix_len == len) {
+			break;
+		}
+
+		parent = link;
+		link = &node->child[prefix_bit(&route->addr, node->prefix_len)];
+	}
+
+	if (node == NULL ||
+	    !sys_slist_find_and_remove(&node->routes, &route->trie_node)) {
+		return;
+	}
+
+	route_trie_compact(link);
+	if (parent != NULL) {
+		route_trie_compact(parent);
+	}
+}
+
+static struct net_route_entry *route_find(struct net_if *iface,
+					  struct in6_addr *dst)
+{
+	struct route_trie_node *node = route_trie_root;
+	struct net_route_entry *route, *found;
+
+	found = route_cache_get(iface, dst);
+	if (found != NULL) {
+		return found;
+	}
+
+	while (node != NULL &&
+	       net_ipv6_is_prefix(dst->s6_addr, node->prefix.s6_addr,
+				  node->prefix_len)) {
+		SYS_SLIST_FOR_EACH_CONTAINER(&node->routes, route, trie_node) {
+			if (iface == NULL || route->iface == iface) {
+				found = route;
+				break;
+			}
+		}
+
+		if (node->prefix_len == 128U) {
+			break;
+		}
+
+		node = node->child[prefix_bit(dst, node->prefix_len)];
+	}
+
+	if (found != NULL) {
+		route_cache_put(iface, dst, found);
+	}
+
+	return found;
+}
+
+static void route_trie_init(void)
+{
+	route_trie_root = NULL;
+	route_trie_free = NULL;
+
+	for (int i = 0; i < ARRAY_SIZE(route_trie_nodes); i++) {
+		route_trie_node_free(&route_trie_nodes[i]);
+	}
+
+	route_cache_flush();
+}
+#else
+static struct net_route_entry *route_find(struct net_if *iface,
+					  struct in6_addr *dst)
 {
 	struct net_route_entry *route, *found = NULL;
 	uint8_t longest_match = 0U;
 	int i;
 
-	net_ipv6_nbr_lock();
-
 	for (i = 0; i < CONFIG_NET_MAX_ROUTES && longest_match < 128; i++) {
 		struct net_nbr *nbr = get_nbr(i);
 
@@ -298,6 +573,23 @@ struct net_route_entry *net_route_lookup(struct net_if *iface,
 		}
 	}
 
+	return found;
+}
+
+#define route_trie_add(...) 0
+#define route_trie_del(...)
+#define route_trie_init(...)
+#endif /* CONFIG_NET_ROUTE_LPM_TRIE */
+
+struct net_route_entry *net_route_lookup(struct net_if *iface,
+					 struct in6_addr *dst)
+{
+	struct net_route_entry *found;
+
+	net_ipv6_nbr_lock();
+
+	found = route_find(iface, dst);
+
 	if (found) {
 		net_route_info("Found", found, dst);
 
@@ -455,6 +747,13 @@ struct net_route_entry *net_route_add(struct net_if *iface,
 	sys_slist_init(&route->nexthop);
 	sys_slist_prepend(&route->nexthop, &nexthop_route->node);
 
+	if (route_trie_add(route) < 0) {
+		NET_ERR("No route trie node available!");
+		net_route_del(route);
+		route = NULL;
+		goto exit;
+	}
+
 	net_route_info("Added", route, addr);
 
 #if defined(CONFIG_NET_MGMT_EVENT_INFO)
@@ -587,6 +886,7 @@ int net_route_del(struct net_route_entry *route)
 	}
 
 	sys_slist_find_and_remove(&routes, &route->node);
+	route_trie_del(route);
 
 	nbr = net_route_get_nbr(route);
 	if (!nbr) {
@@ -1113,5 +1413,7 @@ void net_route_init(void)
 #if defined(CONFIG_NET_ROUTE_MCAST)
 	memset(route_mcast_entries, 0, sizeof(route_mcast_entries));
 #endif
+	route_trie_init();
+
 	k_work_init_delayable(&route_lifetime_timer, route_lifetime_timeout);
 }
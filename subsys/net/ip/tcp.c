@@ -58,12 +58,18 @@ static int tcp_tx_window =
 	CONFIG_NET_PKT_BUF_TX_DATA_POOL_SIZE / 3;
 #endif /* CONFIG_NET_BUF_FIXED_DATA_SIZE */
 #endif
-#ifdef CONFIG_NET_TCP_RANDOMIZED_RTO
+#if defined(CONFIG_NET_TCP_RANDOMIZED_RTO)
 #define TCP_RTO_MS (conn->rto)
+#elif defined(CONFIG_NET_TCP_TIMESTAMPS)
+#define TCP_RTO_MS (conn->rtt.rto)
 #else
 #define TCP_RTO_MS (tcp_rto)
 #endif
 
+/* Bounds of the RTO computed from RTT samples */
+#define TCP_RTO_MIN_MS 200
+#define TCP_RTO_MAX_MS 60000
+
 /* Define the number of MSS sections the congestion window is initialized at */
 #define TCP_CONGESTION_INITIAL_WIN 1
 #define TCP_CONGESTION_INITIAL_SSTHRESH 3
@@ -432,14 +438,54 @@ static void tcp_derive_rto(struct tcp *conn)
 	gain = (uint32_t)gain8;
 	gain += 1 << 9;
 
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+	rto = conn->rtt.rto;
+#else
 	rto = (uint32_t)tcp_rto;
+#endif
 	rto = (gain * rto) >> 9;
-	conn->rto = (uint16_t)rto;
+	conn->rto = (uint16_t)MIN(rto, UINT16_MAX);
 #else
 	ARG_UNUSED(conn);
 #endif
 }
 
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+/* Update the RTT estimate and the RTO with a new sample, RFC 6298 */
+static void tcp_rtt_update(struct tcp *conn, uint32_t rtt)
+{
+	struct tcp_rtt *r = &conn->rtt;
+	uint32_t rto;
+
+	if (r->samples == 0U) {
+		r->srtt = rtt << 3;
+		r->rttvar = rtt << 1;
+		r->min = rtt;
+	} else {
+		int32_t delta = (int32_t)rtt - (int32_t)(r->srtt >> 3);
+
+		r->srtt += delta;
+		r->rttvar += abs(delta) - (r->rttvar >> 2);
+		r->min = MIN(r->min, rtt);
+	}
+
+	r->last = rtt;
+	r->samples++;
+
+	/* The timestamp clock has a granularity of 1 ms */
+	rto = (r->srtt >> 3) + MAX(r->rttvar, 1U);
+	rto = CLAMP(rto, TCP_RTO_MIN_MS, TCP_RTO_MAX_MS);
+
+	NET_DBG("conn: %p rtt=%u srtt=%u rttvar=%u rto=%u", conn, rtt,
+		r->srtt >> 3, r->rttvar >> 2, rto);
+
+	if (rto != r->rto) {
+		r->rto = rto;
+		tcp_derive_rto(conn);
+	}
+}
+#endif
+
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 
 /* Implementation according to RFC6582 */
@@ -487,6 +533,14 @@ static void tcp_new_reno_dup_ack(struct tcp *conn)
 	tcp_new_reno_log(conn, "dup_ack");
 }
 
+/* Loss recovery driven by SACK information has completed */
+static void tcp_new_reno_recovery_end(struct tcp *conn)
+{
+	conn->ca.pending_fast_retransmit_bytes = 0;
+	conn->ca.cwnd = conn->ca.ssthresh;
+	tcp_new_reno_log(conn, "recovery_end");
+}
+
 static void tcp_new_reno_pkts_acked(struct tcp *conn, uint32_t acked_len)
 {
 	int32_t new_win = conn->ca.cwnd;
@@ -513,29 +567,130 @@ static void tcp_new_reno_pkts_acked(struct tcp *conn, uint32_t acked_len)
 	tcp_new_reno_log(conn, "pkts_acked");
 }
 
+static const struct tcp_ca_ops tcp_ca_new_reno = {
+	.name = "reno",
+	.init = tcp_new_reno_init,
+	.on_ack = tcp_new_reno_pkts_acked,
+	.on_dup_ack = tcp_new_reno_dup_ack,
+	.on_loss = tcp_new_reno_fast_retransmit,
+	.on_recovery_end = tcp_new_reno_recovery_end,
+	.on_rto = tcp_new_reno_timeout,
+};
+
+static const struct tcp_ca_ops *const tcp_ca_algorithms[] = {
+	&tcp_ca_new_reno,
+#ifdef CONFIG_NET_TCP_CONGESTION_CUBIC
+	&tcp_ca_cubic,
+#endif
+#ifdef CONFIG_NET_TCP_CONGESTION_BBR
+	&tcp_ca_bbr,
+#endif
+};
+
+#if defined(CONFIG_NET_TCP_CONGESTION_DEFAULT_CUBIC)
+#define TCP_CA_DEFAULT (&tcp_ca_cubic)
+#elif defined(CONFIG_NET_TCP_CONGESTION_DEFAULT_BBR)
+#define TCP_CA_DEFAULT (&tcp_ca_bbr)
+#else
+#define TCP_CA_DEFAULT (&tcp_ca_new_reno)
+#endif
+
+static const struct tcp_ca_ops *tcp_ca_find(const char *name, size_t len)
+{
+	ARRAY_FOR_EACH(tcp_ca_algorithms, i) {
+		const char *ca_name = tcp_ca_algorithms[i]->name;
+
+		if (strlen(ca_name) == len && strncmp(ca_name, name, len) == 0) {
+			return tcp_ca_algorithms[i];
+		}
+	}
+
+	return NULL;
+}
+
 static void tcp_ca_init(struct tcp *conn)
 {
-	tcp_new_reno_init(conn);
+	conn->ca_ops->init(conn);
 }
 
 static void tcp_ca_fast_retransmit(struct tcp *conn)
 {
-	tcp_new_reno_fast_retransmit(conn);
+	conn->ca_ops->on_loss(conn);
 }
 
 static void tcp_ca_timeout(struct tcp *conn)
 {
-	tcp_new_reno_timeout(conn);
+	conn->ca_ops->on_rto(conn);
 }
 
 static void tcp_ca_dup_ack(struct tcp *conn)
 {
-	tcp_new_reno_dup_ack(conn);
+	conn->ca_ops->on_dup_ack(conn);
+}
+
+static inline void tcp_ca_recovery_end(struct tcp *conn)
+{
+	conn->ca_ops->on_recovery_end(conn);
 }
 
 static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len)
 {
-	tcp_new_reno_pkts_acked(conn, acked_len);
+	conn->ca_ops->on_ack(conn, acked_len);
+}
+
+static inline void tcp_ca_delivered(struct tcp *conn, uint32_t acked_len)
+{
+	if (conn->ca_ops->on_delivered != NULL) {
+		conn->ca_ops->on_delivered(conn, acked_len);
+	}
+}
+
+static inline uint32_t tcp_ca_pacing_rate(struct tcp *conn)
+{
+	if (conn->ca_ops->pacing_rate == NULL) {
+		return 0U;
+	}
+
+	return conn->ca_ops->pacing_rate(conn);
+}
+
+/* The new algorithm starts over from its initial window */
+static int set_tcp_congestion(struct tcp *conn, const void *value, size_t len)
+{
+	const struct tcp_ca_ops *ops;
+
+	if (value == NULL) {
+		return -EINVAL;
+	}
+
+	ops = tcp_ca_find(value, strnlen(value, len));
+	if (ops == NULL) {
+		return -ENOENT;
+	}
+
+	if (ops != conn->ca_ops) {
+		conn->ca_ops = ops;
+		if (conn->state == TCP_ESTABLISHED ||
+		    conn->state == TCP_CLOSE_WAIT) {
+			tcp_ca_init(conn);
+		}
+	}
+
+	return 0;
+}
+
+static int get_tcp_congestion(struct tcp *conn, void *value, size_t *len)
+{
+	size_t name_len = strlen(conn->ca_ops->name) + 1;
+
+	if (value == NULL || len == NULL) {
+		return -EINVAL;
+	}
+
+	*len = MIN(*len, name_len);
+	memcpy(value, conn->ca_ops->name, *len);
+
+	return 0;
 }
 #else
 
@@ -547,8 +702,15 @@ static void tcp_ca_timeout(struct tcp *conn) { }
 
 static void tcp_ca_dup_ack(struct tcp *conn) { }
 
+static inline void tcp_ca_recovery_end(struct tcp *conn) { }
+
 static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len) { }
 
+static inline void tcp_ca_delivered(struct tcp *conn, uint32_t acked_len) { }
+
+#define set_tcp_congestion(...) (-ENOPROTOOPT)
+#define get_tcp_congestion(...) (-ENOPROTOOPT)
+
 #endif
 
 #if defined(CONFIG_NET_TCP_KEEPALIVE)
@@ -804,6 +966,9 @@ static void tcp_conn_release(struct k_work *work)
 	(void)k_work_cancel_delayable(&conn->ack_timer);
 	(void)k_work_cancel_delayable(&conn->send_timer);
 	(void)k_work_cancel_delayable(&conn->recv_queue_timer);
+#ifdef CONFIG_NET_TCP_PACING
+	(void)k_work_cancel_delayable(&conn->pacing_timer);
+#endif
 	keep_alive_timer_stop(conn);
 
 	k_mutex_unlock(&conn->lock);
@@ -1104,8 +1269,13 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 
 	NET_DBG("len=%zd", len);
 
-	recv_options->mss_found = false;
-	recv_options->wnd_found = false;
+	/* MSS and window scale are only sent in the SYN, keep them when later
+	 * segments carry other options.
+	 */
+#ifdef CONFIG_NET_TCP_SACK
+	recv_options->sack_perm_found = false;
+	recv_options->sack_blocks = 0U;
+#endif
 
 	for ( ; options && len >= 1; options += opt_len, len -= opt_len) {
 		opt = options[0];
@@ -1154,6 +1324,50 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 			recv_options->window = opt;
 			recv_options->wnd_found = true;
 			break;
+#ifdef CONFIG_NET_TCP_SACK
+		case NET_TCP_SACK_PERM_OPT:
+			if (opt_len != NET_TCP_SACK_PERM_SIZE) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_perm_found = true;
+			break;
+		case NET_TCP_SACK_OPT:
+			if (opt_len < 2 + NET_TCP_SACK_BLOCK_SIZE ||
+			    (opt_len - 2) % NET_TCP_SACK_BLOCK_SIZE != 0) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_blocks =
+				MIN((opt_len - 2) / NET_TCP_SACK_BLOCK_SIZE,
+				    NET_TCP_SACK_MAX_BLOCKS);
+
+			for (int i = 0; i < recv_options->sack_blocks; i++) {
+				uint8_t *block = options + 2 + i * NET_TCP_SACK_BLOCK_SIZE;
+
+				recv_options->sack[i].start =
+					ntohl(UNALIGNED_GET((uint32_t *)block));
+				recv_options->sack[i].end =
+					ntohl(UNALIGNED_GET((uint32_t *)(block + 4)));
+			}
+			break;
+#endif
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+		case NET_TCP_TIMESTAMP_OPT:
+			if (opt_len != NET_TCP_TIMESTAMP_SIZE) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->tsval =
+				ntohl(UNALIGNED_GET((uint32_t *)(options + 2)));
+			recv_options->tsecr =
+				ntohl(UNALIGNED_GET((uint32_t *)(options + 6)));
+			recv_options->ts_found = true;
+			break;
+#endif
 		default:
 			continue;
 		}
@@ -1214,6 +1428,27 @@ static int tcp_update_recv_wnd(struct tcp *conn, int32_t delta)
 	return 0;
 }
 
+/* Out-of-order data is queued in conn->queue_recv_data as a list of
+ * buffers sorted by sequence number, each tagged with the sequence number
+ * of its first byte. Gaps separate the runs of contiguous data.
+ *
+ * Returns the sequence number following the run starting with @a buf, and
+ * the last buffer of that run in @a last.
+ */
+static uint32_t tcp_recv_run_end(struct net_buf *buf, struct net_buf **last)
+{
+	uint32_t end = tcp_get_seq(buf) + buf->len;
+
+	while ((buf->frags != NULL) && (tcp_get_seq(buf->frags) == end)) {
+		buf = buf->frags;
+		end += buf->len;
+	}
+
+	*last = buf;
+
+	return end;
+}
+
 static size_t tcp_check_pending_data(struct tcp *conn, struct net_pkt *pkt,
 				     size_t len)
 {
@@ -1221,55 +1456,46 @@ static size_t tcp_check_pending_data(struct tcp *conn, struct net_pkt *pkt,
 
 	if (CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT &&
 	    !net_pkt_is_empty(conn->queue_recv_data)) {
-		/* Some potentential cases:
-		 * Note: MI = MAX_INT
-		 * Packet | Queued| End off   | Gap size | Required handling
-		 * Seq|Len|Seq|Len|           |          |
-		 *  3 | 3 | 6 | 4 | 3+3-6=  0 | 6-3-3=0  | Append
-		 *  3 | 4 | 6 | 4 | 3+4-6 = 1 | 6-3-4=-1 | Append, pull from queue
-		 *  3 | 7 | 6 | 4 | 3+7-6 = 4 | 6-3-7=-4 | Drop queued data
-		 *  3 | 8 | 6 | 4 | 3+8-6 = 5 | 6-3-8=-5 | Drop queued data
-		 *  6 | 5 | 6 | 4 | 6+5-6 = 5 | 6-6-5=-5 | Drop queued data
-		 *  6 | 4 | 6 | 4 | 6+4-6 = 4 | 6-6-4=-4 | Drop queued data / packet
-		 * 10 | 2 | 6 | 4 | 10+2-6= 6 | 6-10-2=-6| Should not happen, dropping queue
-		 *  7 | 4 | 6 | 4 | 7+4-6 = 5 | 6-7-4=-5 | Should not happen, dropping queue
-		 * 11 | 2 | 6 | 4 | 11+2-6= 7 | 6-11-2=-7| Should not happen, dropping queue
-		 *  2 | 3 | 6 | 4 | 2+3-6= MI | 6-2-3=1  | Keep queued data
-		 */
 		struct tcphdr *th = th_get(pkt);
 		uint32_t expected_seq = th_seq(th) + len;
+		struct net_buf *buf = conn->queue_recv_data->buffer;
+		struct net_buf *last;
 		uint32_t pending_seq;
-		int32_t gap_size;
 		uint32_t end_offset;
+		uint32_t end;
+
+		/* Drop the queued data the incoming data covers */
+		while ((buf != NULL) &&
+		       (net_tcp_seq_cmp(tcp_get_seq(buf) + buf->len,
+					expected_seq) <= 0)) {
+			buf = net_buf_frag_del(NULL, buf);
+		}
+		conn->queue_recv_data->buffer = buf;
+
+		/* Hand over the first run if it continues the incoming data,
+		 * the next ones stay queued behind their gaps.
+		 */
+		if ((buf != NULL) &&
+		    (net_tcp_seq_cmp(tcp_get_seq(buf), expected_seq) <= 0)) {
+			pending_seq = tcp_get_seq(buf);
+			end_offset = expected_seq - pending_seq;
+			end = tcp_recv_run_end(buf, &last);
 
-		pending_seq = tcp_get_seq(conn->queue_recv_data->buffer);
-		end_offset = expected_seq - pending_seq;
-		gap_size = (int32_t)(pending_seq - th_seq(th) - ((uint32_t)len));
-		pending_len = net_pkt_get_len(conn->queue_recv_data);
-		if (end_offset < pending_len) {
 			if (end_offset) {
 				net_pkt_remove_tail(pkt, end_offset);
-				pending_len -= end_offset;
 			}
 
+			conn->queue_recv_data->buffer = last->frags;
+			last->frags = NULL;
+			net_buf_frag_add(pkt->buffer, buf);
+			pending_len = end - expected_seq;
+
 			NET_DBG("Found pending data seq %u len %zd",
 				expected_seq, pending_len);
+		}
 
-			net_buf_frag_add(pkt->buffer,
-					 conn->queue_recv_data->buffer);
-			conn->queue_recv_data->buffer = NULL;
-
+		if (net_pkt_is_empty(conn->queue_recv_data)) {
 			k_work_cancel_delayable(&conn->recv_queue_timer);
-		} else {
-			/* Check if the queued data is just a section of the incoming data */
-			if (gap_size <= 0) {
-				net_buf_unref(conn->queue_recv_data->buffer);
-				conn->queue_recv_data->buffer = NULL;
-
-				k_work_cancel_delayable(&conn->recv_queue_timer);
-			}
-
-			pending_len = 0;
 		}
 	}
 
@@ -1327,8 +1553,162 @@ static int tcp_finalize_pkt(struct net_pkt *pkt)
 	return -EINVAL;
 }
 
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+/* Timestamp clock, in milliseconds from a random offset, RFC 7323 */
+static uint32_t tcp_ts_now(struct tcp *conn)
+{
+	return k_uptime_get_32() + conn->ts_offset;
+}
+#endif
+
+#ifdef CONFIG_NET_TCP_SACK
+/* Finds the queued run of out-of-order data holding @a seq */
+static bool tcp_recv_run_find(struct tcp *conn, uint32_t seq,
+			      struct tcp_sack_block *run)
+{
+	struct net_buf *buf;
+	struct net_buf *last;
+
+	if (conn->queue_recv_data == NULL) {
+		return false;
+	}
+
+	for (buf = conn->queue_recv_data->buffer; buf != NULL; buf = last->frags) {
+		run->start = tcp_get_seq(buf);
+		run->end = tcp_recv_run_end(buf, &last);
+
+		if ((net_tcp_seq_cmp(seq, run->start) >= 0) &&
+		    (net_tcp_seq_cmp(seq, run->end) < 0)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Fills @a blocks with the queued runs reported last, the one holding the
+ * most recently received data first, and returns their number. Runs that
+ * merged count once, delivered or discarded ones are skipped.
+ */
+static int tcp_sack_recv_blocks(struct tcp *conn, struct tcp_sack_block *blocks,
+				int max)
+{
+	struct tcp_sack_block run;
+	int num = 0;
+
+	for (int i = 0; (i < conn->sack_recv_num) && (num < max); i++) {
+		bool reported = false;
+
+		if (!tcp_recv_run_find(conn, conn->sack_recv_seq[i], &run) ||
+		    !net_tcp_seq_greater(run.start, conn->ack)) {
+			continue;
+		}
+
+		for (int j = 0; j < num; j++) {
+			reported |= (blocks[j].start == run.start);
+		}
+
+		if (!reported) {
+			blocks[num++] = run;
+		}
+	}
+
+	return num;
+}
+
+/* The run holding out-of-order data just received at @a seq goes first in
+ * the SACK blocks, followed by the ones reported before it, RFC 2018
+ * section 4.
+ */
+static void tcp_sack_recv_add(struct tcp *conn, uint32_t seq)
+{
+	struct tcp_sack_block blocks[NET_TCP_SACK_MAX_BLOCKS];
+	struct tcp_sack_block run;
+	int num;
+
+	if (!tcp_recv_run_find(conn, seq, &run)) {
+		return;
+	}
+
+	num = tcp_sack_recv_blocks(conn, blocks, ARRAY_SIZE(blocks));
+
+	conn->sack_recv_seq[0] = run.start;
+	conn->sack_recv_num = 1;
+	for (int i = 0; (i < num) && (conn->sack_recv_num < ARRAY_SIZE(blocks)); i++) {
+		if (blocks[i].start != run.start) {
+			conn->sack_recv_seq[conn->sack_recv_num++] = blocks[i].start;
+		}
+	}
+}
+
+/* SACK blocks sent in an ACK, as many as fit next to the other options */
+static int tcp_sack_recv_get(struct tcp *conn, struct tcp_sack_block *blocks)
+{
+	size_t space = NET_TCP_MAX_OPT_SIZE - 2 * NET_TCP_NOP_SIZE - 2;
+
+	if (!conn->sack_permitted) {
+		return 0;
+	}
+
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+	if (conn->ts_enabled) {
+		space -= 2 * NET_TCP_NOP_SIZE + NET_TCP_TIMESTAMP_SIZE;
+	}
+#endif
+
+	return tcp_sack_recv_blocks(conn, blocks,
+				    MIN(space / NET_TCP_SACK_BLOCK_SIZE,
+					NET_TCP_SACK_MAX_BLOCKS));
+}
+#else
+
+static inline void tcp_sack_recv_add(struct tcp *conn, uint32_t seq) { }
+
+#endif
+
+/* Length of the TCP options that tcp_options_add() appends */
+static size_t tcp_options_len(struct tcp *conn, uint8_t flags)
+{
+#ifdef CONFIG_NET_TCP_SACK
+	struct tcp_sack_block blocks[NET_TCP_SACK_MAX_BLOCKS];
+	int num;
+#endif
+	size_t len = 0;
+
+	if (conn->send_options.mss_found) {
+		len += NET_TCP_MSS_SIZE;
+	}
+
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+	if (conn->ts_enabled) {
+		len += 2 * NET_TCP_NOP_SIZE + NET_TCP_TIMESTAMP_SIZE;
+	}
+#endif
+
+#ifdef CONFIG_NET_TCP_SACK
+	if (conn->send_options.sack_perm_found) {
+		len += 2 * NET_TCP_NOP_SIZE + NET_TCP_SACK_PERM_SIZE;
+	} else if ((flags & (ACK | SYN)) == ACK) {
+		num = tcp_sack_recv_get(conn, blocks);
+		if (num > 0) {
+			len += 2 * NET_TCP_NOP_SIZE + 2 + num * NET_TCP_SACK_BLOCK_SIZE;
+		}
+	}
+#else
+	ARG_UNUSED(flags);
+#endif
+
+	return len;
+}
+
+/* Payload that fits in a data segment next to its TCP options */
+static int tcp_send_mss(struct tcp *conn)
+{
+	return conn_mss(conn) - tcp_options_len(conn, PSH | ACK);
+}
+
 static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
-			  uint32_t seq)
+			  uint32_t seq, size_t opts_len)
 {
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
 	struct tcphdr *th;
@@ -1342,11 +1722,7 @@ static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 
 	UNALIGNED_PUT(conn->src.sin.sin_port, &th->th_sport);
 	UNALIGNED_PUT(conn->dst.sin.sin_port, &th->th_dport);
-	th->th_off = 5;
-
-	if (conn->send_options.mss_found) {
-		th->th_off++;
-	}
+	th->th_off = 5 + opts_len / 4;
 
 	UNALIGNED_PUT(flags, &th->th_flags);
 	UNALIGNED_PUT(htons(conn->recv_win), &th->th_win);
@@ -1426,6 +1802,93 @@ static int net_tcp_set_mss_opt(struct tcp *conn, struct net_pkt *pkt)
 	return net_pkt_set_data(pkt, &mss_opt_access);
 }
 
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+static int net_tcp_set_ts_opt(struct tcp *conn, struct net_pkt *pkt)
+{
+	uint8_t opt[2 * NET_TCP_NOP_SIZE + NET_TCP_TIMESTAMP_SIZE] = {
+		NET_TCP_NOP_OPT, NET_TCP_NOP_OPT,
+		NET_TCP_TIMESTAMP_OPT, NET_TCP_TIMESTAMP_SIZE,
+	};
+
+	UNALIGNED_PUT(htonl(tcp_ts_now(conn)), (uint32_t *)&opt[4]);
+	UNALIGNED_PUT(htonl(conn->ts_recent), (uint32_t *)&opt[8]);
+
+	/* Needed to tell which timestamp to echo, RFC 7323 chapter 4.3 */
+	conn->ts_last_ack_sent = conn->ack;
+
+	return net_pkt_write(pkt, opt, sizeof(opt));
+}
+#endif
+
+#ifdef CONFIG_NET_TCP_SACK
+static int net_tcp_set_sack_opt(struct tcp *conn, struct net_pkt *pkt,
+				uint8_t flags)
+{
+	uint8_t opt[2 * NET_TCP_NOP_SIZE + 2 +
+		    NET_TCP_SACK_MAX_BLOCKS * NET_TCP_SACK_BLOCK_SIZE] = {
+		NET_TCP_NOP_OPT, NET_TCP_NOP_OPT,
+	};
+	struct tcp_sack_block blocks[NET_TCP_SACK_MAX_BLOCKS];
+	int num;
+
+	if (conn->send_options.sack_perm_found) {
+		opt[2] = NET_TCP_SACK_PERM_OPT;
+		opt[3] = NET_TCP_SACK_PERM_SIZE;
+
+		return net_pkt_write(pkt, opt, 4);
+	}
+
+	if ((flags & (ACK | SYN)) != ACK) {
+		return 0;
+	}
+
+	num = tcp_sack_recv_get(conn, blocks);
+	if (num == 0) {
+		return 0;
+	}
+
+	opt[2] = NET_TCP_SACK_OPT;
+	opt[3] = 2 + num * NET_TCP_SACK_BLOCK_SIZE;
+	for (int i = 0; i < num; i++) {
+		uint8_t *block = &opt[4 + i * NET_TCP_SACK_BLOCK_SIZE];
+
+		UNALIGNED_PUT(htonl(blocks[i].start), (uint32_t *)&block[0]);
+		UNALIGNED_PUT(htonl(blocks[i].end), (uint32_t *)&block[4]);
+	}
+
+	return net_pkt_write(pkt, opt, 4 + num * NET_TCP_SACK_BLOCK_SIZE);
+}
+#endif
+
+static int tcp_options_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags)
+{
+	int ret = 0;
+
+	if (conn->send_options.mss_found) {
+		ret = net_tcp_set_mss_opt(conn, pkt);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+	if (conn->ts_enabled) {
+		ret = net_tcp_set_ts_opt(conn, pkt);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+#endif
+
+#ifdef CONFIG_NET_TCP_SACK
+	ret = net_tcp_set_sack_opt(conn, pkt, flags);
+#else
+	ARG_UNUSED(flags);
+#endif
+
+	return ret;
+}
+
 static bool is_destination_local(struct net_pkt *pkt)
 {
 	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
@@ -1530,14 +1993,11 @@ err:
 static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		       uint32_t seq)
 {
-	size_t alloc_len = sizeof(struct tcphdr);
+	size_t opts_len = tcp_options_len(conn, flags);
+	size_t alloc_len = sizeof(struct tcphdr) + opts_len;
 	struct net_pkt *pkt;
 	int ret = 0;
 
-	if (conn->send_options.mss_found) {
-		alloc_len += sizeof(uint32_t);
-	}
-
 	pkt = tcp_pkt_alloc(conn, alloc_len);
 	if (!pkt) {
 		ret = -ENOBUFS;
@@ -1556,20 +2016,18 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		goto out;
 	}
 
-	ret = tcp_header_add(conn, pkt, flags, seq);
+	ret = tcp_header_add(conn, pkt, flags, seq, opts_len);
+	if (ret < 0) {
+		tcp_pkt_unref(pkt);
+		goto out;
+	}
+
+	ret = tcp_options_add(conn, pkt, flags);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
 		goto out;
 	}
 
-	if (conn->send_options.mss_found) {
-		ret = net_tcp_set_mss_opt(conn, pkt);
-		if (ret < 0) {
-			tcp_pkt_unref(pkt);
-			goto out;
-		}
-	}
-
 	ret = tcp_finalize_pkt(pkt);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
@@ -1643,188 +2101,637 @@ static int tcp_pkt_append(struct net_pkt *pkt, const uint8_t *data, size_t len)
 	if (pkt->buffer) {
 		buf = net_buf_frag_last(pkt->buffer);
 
-		if (len > net_buf_tailroom(buf)) {
-			alloc_len -= net_buf_tailroom(buf);
-		} else {
-			alloc_len = 0;
+		if (len > net_buf_tailroom(buf)) {
+			alloc_len -= net_buf_tailroom(buf);
+		} else {
+			alloc_len = 0;
+		}
+	}
+
+	if (alloc_len > 0) {
+		ret = net_pkt_alloc_buffer_raw(pkt, alloc_len,
+					       TCP_PKT_ALLOC_TIMEOUT);
+		if (ret < 0) {
+			return -ENOBUFS;
+		}
+	}
+
+	if (buf == NULL) {
+		buf = pkt->buffer;
+	}
+
+	while (buf != NULL && len > 0) {
+		size_t write_len = MIN(len, net_buf_tailroom(buf));
+
+		net_buf_add_mem(buf, data, write_len);
+
+		data += write_len;
+		len -= write_len;
+		buf = buf->frags;
+	}
+
+	NET_ASSERT(len == 0, "Not all bytes written");
+
+	return ret;
+}
+
+static bool tcp_window_full(struct tcp *conn)
+{
+	bool window_full = (conn->send_data_total >= conn->send_win);
+
+#ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
+	window_full = window_full || (conn->send_data_total >= conn->ca.cwnd);
+#endif
+
+	if (window_full) {
+		NET_DBG("conn: %p TX window_full", conn);
+	}
+
+	return window_full;
+}
+
+static int tcp_unsent_len(struct tcp *conn)
+{
+	int unsent_len;
+
+	if (conn->unacked_len > conn->send_data_total) {
+		NET_ERR("total=%zu, unacked_len=%d",
+			conn->send_data_total, conn->unacked_len);
+		unsent_len = -ERANGE;
+		goto out;
+	}
+
+	unsent_len = conn->send_data_total - conn->unacked_len;
+	if (conn->unacked_len >= conn->send_win) {
+		unsent_len = 0;
+	} else {
+		unsent_len = MIN(unsent_len, conn->send_win - conn->unacked_len);
+
+#ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
+		if (conn->unacked_len >= conn->ca.cwnd) {
+			unsent_len = 0;
+		} else {
+			unsent_len = MIN(unsent_len, conn->ca.cwnd - conn->unacked_len);
+		}
+#endif
+	}
+ out:
+	return unsent_len;
+}
+
+/* Send len bytes of send_data, starting at offset, as one segment */
+static int tcp_send_segment(struct tcp *conn, int offset, int len)
+{
+	struct net_pkt *pkt;
+	int ret;
+
+	pkt = tcp_pkt_alloc(conn, len);
+	if (!pkt) {
+		NET_ERR("conn: %p packet allocation failed, len=%d", conn, len);
+		return -ENOBUFS;
+	}
+
+	ret = tcp_pkt_peek(pkt, conn->send_data, offset, len);
+	if (ret < 0) {
+		tcp_pkt_unref(pkt);
+		return -ENOBUFS;
+	}
+
+	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + offset);
+	if (ret == 0) {
+		if (conn->data_mode == TCP_DATA_MODE_RESEND ||
+		    offset < conn->unacked_len) {
+			net_stats_update_tcp_resent(conn->iface, len);
+			net_stats_update_tcp_seg_rexmit(conn->iface);
+		} else {
+			net_stats_update_tcp_sent(conn->iface, len);
+			net_stats_update_tcp_seg_sent(conn->iface);
+		}
+	}
+
+	/* The data we want to send, has been moved to the send queue so we
+	 * can unref the head net_pkt. If there was an error, we need to remove
+	 * the packet anyway.
+	 */
+	tcp_pkt_unref(pkt);
+
+	return ret;
+}
+
+static int tcp_send_data(struct tcp *conn)
+{
+	int ret = 0;
+	int len;
+
+	len = MIN(tcp_unsent_len(conn), tcp_send_mss(conn));
+	if (len < 0) {
+		ret = len;
+		goto out;
+	}
+	if (len == 0) {
+		NET_DBG("conn: %p no data to send", conn);
+		ret = -ENODATA;
+		goto out;
+	}
+
+	ret = tcp_send_segment(conn, conn->unacked_len, len);
+	if (ret == 0) {
+		conn->unacked_len += len;
+	}
+
+	conn_send_data_dump(conn);
+
+ out:
+	return ret;
+}
+
+#ifdef CONFIG_NET_TCP_PACING
+
+/* Returns true when the pacing rate does not allow sending yet, the
+ * pacing timer then resumes the transmission.
+ */
+static bool tcp_pacing_wait(struct tcp *conn)
+{
+	int64_t now_us = k_ticks_to_us_floor64(k_uptime_ticks());
+
+	if (conn->pacing_next_us <= now_us) {
+		return false;
+	}
+
+	k_work_reschedule_for_queue(&tcp_work_q, &conn->pacing_timer,
+				    K_USEC(conn->pacing_next_us - now_us));
+
+	return true;
+}
+
+static void tcp_pacing_sent(struct tcp *conn, int len)
+{
+	uint32_t rate = tcp_ca_pacing_rate(conn);
+	int64_t now_us;
+
+	if (rate == 0U) {
+		return;
+	}
+
+	now_us = k_ticks_to_us_floor64(k_uptime_ticks());
+	conn->pacing_next_us = MAX(conn->pacing_next_us, now_us) +
+			       (int64_t)len * USEC_PER_SEC / rate;
+}
+
+#else
+
+static inline bool tcp_pacing_wait(struct tcp *conn) { return false; }
+
+static inline void tcp_pacing_sent(struct tcp *conn, int len) { }
+
+#endif /* CONFIG_NET_TCP_PACING */
+
+/* Send all queued but unsent data from the send_data packet by packet
+ * until the receiver's window is full. */
+static int tcp_send_queued_data(struct tcp *conn)
+{
+	int ret = 0;
+	int sent;
+	bool subscribe = false;
+
+	if (conn->data_mode == TCP_DATA_MODE_RESEND) {
+		goto out;
+	}
+
+	while (tcp_unsent_len(conn) > 0) {
+		/* Implement Nagle's algorithm */
+		if ((conn->tcp_nodelay == false) && (conn->unacked_len > 0)) {
+			/* If there is already pending data */
+			if (tcp_unsent_len(conn) < conn_mss(conn)) {
+				/* The number of bytes to be transmitted is less than an MSS,
+				 * skip transmission for now.
+				 * Wait for more data to be transmitted or all pending data
+				 * being acknowledged.
+				 */
+				break;
+			}
+		}
+
+		if (tcp_pacing_wait(conn)) {
+			break;
+		}
+
+		sent = conn->unacked_len;
+		ret = tcp_send_data(conn);
+		if (ret < 0) {
+			break;
+		}
+
+		tcp_pacing_sent(conn, conn->unacked_len - sent);
+	}
+
+	if (conn->send_data_total) {
+		subscribe = true;
+	}
+
+	if (k_work_delayable_remaining_get(&conn->send_data_timer)) {
+		subscribe = false;
+	}
+
+	if (subscribe) {
+		conn->send_data_retries = 0;
+		k_work_reschedule_for_queue(&tcp_work_q, &conn->send_data_timer,
+					    K_MSEC(TCP_RTO_MS));
+	}
+ out:
+	return ret;
+}
+
+#ifdef CONFIG_NET_TCP_PACING
+static void tcp_pacing_resume(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct tcp *conn = CONTAINER_OF(dwork, struct tcp, pacing_timer);
+
+	k_mutex_lock(&conn->lock, K_FOREVER);
+
+	if (conn->state == TCP_ESTABLISHED || conn->state == TCP_CLOSE_WAIT) {
+		(void)tcp_send_queued_data(conn);
+	}
+
+	k_mutex_unlock(&conn->lock);
+}
+#endif
+
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+
+/* Timestamps are used when the SYN and the SYN-ACK both carried them */
+static void tcp_ts_negotiate(struct tcp *conn)
+{
+	conn->ts_enabled = conn->recv_options.ts_found;
+	if (conn->ts_enabled) {
+		conn->ts_recent = conn->recv_options.tsval;
+	}
+}
+
+/* The peer echoes the timestamp of the segment it acknowledges, which
+ * gives an RTT sample even for retransmitted data.
+ */
+static void tcp_ts_rtt_sample(struct tcp *conn)
+{
+	uint32_t rtt;
+
+	if (!conn->ts_enabled || !conn->recv_options.ts_found) {
+		return;
+	}
+
+	rtt = tcp_ts_now(conn) - conn->recv_options.tsecr;
+	if (rtt > TCP_RTO_MAX_MS) {
+		NET_DBG("conn: %p invalid echoed timestamp %u", conn,
+			conn->recv_options.tsecr);
+		return;
+	}
+
+	tcp_rtt_update(conn, rtt);
+}
+
+/* Protection against wrapped sequence numbers (PAWS), RFC 7323. Returns
+ * false when the segment carries an older timestamp than already seen.
+ */
+static bool tcp_ts_accept(struct tcp *conn, struct tcphdr *th)
+{
+	struct tcp_options *opts = &conn->recv_options;
+
+	if (!conn->ts_enabled || !opts->ts_found) {
+		return true;
+	}
+
+	if (net_tcp_seq_greater(conn->ts_recent, opts->tsval)) {
+		return false;
+	}
+
+	if (!net_tcp_seq_greater(th_seq(th), conn->ts_last_ack_sent)) {
+		conn->ts_recent = opts->tsval;
+	}
+
+	return true;
+}
+
+#else
+
+static inline void tcp_ts_negotiate(struct tcp *conn) { }
+
+static inline void tcp_ts_rtt_sample(struct tcp *conn) { }
+
+static inline bool tcp_ts_accept(struct tcp *conn, struct tcphdr *th) { return true; }
+
+#endif /* CONFIG_NET_TCP_TIMESTAMPS */
+
+#ifdef CONFIG_NET_TCP_SACK
+
+/* SACK is used when the SYN and the SYN-ACK both carried SACK-permitted */
+static void tcp_sack_negotiate(struct tcp *conn)
+{
+	conn->sack_permitted = conn->recv_options.sack_perm_found;
+}
+
+static void tcp_sack_syn_options(struct tcp *conn, bool enable)
+{
+	conn->send_options.sack_perm_found = enable && conn->sack_permitted;
+}
+
+static bool tcp_sack_enabled(struct tcp *conn)
+{
+	return conn->sack_permitted;
+}
+
+static void tcp_sack_reset(struct tcp *conn)
+{
+	conn->sack.num_blocks = 0U;
+	conn->sack.in_recovery = false;
+}
+
+static bool tcp_sack_in_recovery(struct tcp *conn)
+{
+	return conn->sack.in_recovery;
+}
+
+static void tcp_sack_insert(struct tcp_sack_scoreboard *sb, uint32_t start,
+			    uint32_t end)
+{
+	struct tcp_sack_block *b = sb->blocks;
+	int i, j;
+
+	for (i = 0; i < sb->num_blocks; i++) {
+		if (net_tcp_seq_cmp(b[i].end, start) >= 0) {
+			break;
+		}
+	}
+
+	/* Merge with the blocks that overlap or touch the new one */
+	for (j = i; j < sb->num_blocks; j++) {
+		if (net_tcp_seq_greater(b[j].start, end)) {
+			break;
+		}
+
+		if (net_tcp_seq_greater(start, b[j].start)) {
+			start = b[j].start;
+		}
+
+		if (net_tcp_seq_greater(b[j].end, end)) {
+			end = b[j].end;
+		}
+	}
+
+	if (j > i) {
+		memmove(&b[i + 1], &b[j], (sb->num_blocks - j) * sizeof(*b));
+		sb->num_blocks -= j - i - 1;
+	} else {
+		/* When full, forget the highest block, the lower ones
+		 * tell what to retransmit first.
+		 */
+		if (sb->num_blocks == NET_TCP_SACK_MAX_BLOCKS) {
+			if (i == NET_TCP_SACK_MAX_BLOCKS) {
+				return;
+			}
+
+			sb->num_blocks--;
+		}
+
+		memmove(&b[i + 1], &b[i], (sb->num_blocks - i) * sizeof(*b));
+		sb->num_blocks++;
+	}
+
+	b[i].start = start;
+	b[i].end = end;
+}
+
+/* Merge the SACK blocks of a received segment into the scoreboard and
+ * drop what is below the cumulative acknowledgment.
+ */
+static void tcp_sack_update(struct tcp *conn, uint32_t ack)
+{
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+	uint32_t high_data = conn->seq + conn->unacked_len;
+	int i;
+
+	if (!conn->sack_permitted) {
+		return;
+	}
+
+	if (net_tcp_seq_greater(conn->seq, ack)) {
+		ack = conn->seq;
+	}
+
+	for (i = 0; i < conn->recv_options.sack_blocks; i++) {
+		uint32_t start = conn->recv_options.sack[i].start;
+		uint32_t end = conn->recv_options.sack[i].end;
+
+		if (net_tcp_seq_greater(ack, start)) {
+			start = ack;
 		}
-	}
 
-	if (alloc_len > 0) {
-		ret = net_pkt_alloc_buffer_raw(pkt, alloc_len,
-					       TCP_PKT_ALLOC_TIMEOUT);
-		if (ret < 0) {
-			return -ENOBUFS;
+		if (net_tcp_seq_greater(end, high_data)) {
+			end = high_data;
 		}
-	}
 
-	if (buf == NULL) {
-		buf = pkt->buffer;
+		if (net_tcp_seq_greater(end, start)) {
+			tcp_sack_insert(sb, start, end);
+		}
 	}
 
-	while (buf != NULL && len > 0) {
-		size_t write_len = MIN(len, net_buf_tailroom(buf));
-
-		net_buf_add_mem(buf, data, write_len);
+	conn->recv_options.sack_blocks = 0U;
 
-		data += write_len;
-		len -= write_len;
-		buf = buf->frags;
+	for (i = 0; i < sb->num_blocks; i++) {
+		if (net_tcp_seq_greater(sb->blocks[i].end, ack)) {
+			break;
+		}
 	}
 
-	NET_ASSERT(len == 0, "Not all bytes written");
+	sb->num_blocks -= i;
+	memmove(&sb->blocks[0], &sb->blocks[i], sb->num_blocks * sizeof(sb->blocks[0]));
 
-	return ret;
+	if (sb->num_blocks > 0 && net_tcp_seq_greater(ack, sb->blocks[0].start)) {
+		sb->blocks[0].start = ack;
+	}
 }
 
-static bool tcp_window_full(struct tcp *conn)
+/* A hole is considered lost when at least DupThresh segments worth of
+ * data, or DupThresh separate blocks, have been SACKed above it. The
+ * blocks above the hole in front of block k are blocks k and up.
+ */
+static bool tcp_sack_is_lost(struct tcp *conn, int k)
 {
-	bool window_full = (conn->send_data_total >= conn->send_win);
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+	uint32_t sacked = 0U;
 
-#ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
-	window_full = window_full || (conn->send_data_total >= conn->ca.cwnd);
-#endif
+	if (sb->num_blocks - k >= DUPLICATE_ACK_RETRANSMIT_TRHESHOLD) {
+		return true;
+	}
 
-	if (window_full) {
-		NET_DBG("conn: %p TX window_full", conn);
+	for (int i = k; i < sb->num_blocks; i++) {
+		sacked += sb->blocks[i].end - sb->blocks[i].start;
 	}
 
-	return window_full;
+	return sacked > (DUPLICATE_ACK_RETRANSMIT_TRHESHOLD - 1) * conn_mss(conn);
 }
 
-static int tcp_unsent_len(struct tcp *conn)
+static bool tcp_sack_loss_detected(struct tcp *conn)
 {
-	int unsent_len;
-
-	if (conn->unacked_len > conn->send_data_total) {
-		NET_ERR("total=%zu, unacked_len=%d",
-			conn->send_data_total, conn->unacked_len);
-		unsent_len = -ERANGE;
-		goto out;
-	}
+	return conn->sack_permitted && conn->sack.num_blocks > 0 &&
+	       tcp_sack_is_lost(conn, 0);
+}
 
-	unsent_len = conn->send_data_total - conn->unacked_len;
-	if (conn->unacked_len >= conn->send_win) {
-		unsent_len = 0;
-	} else {
-		unsent_len = MIN(unsent_len, conn->send_win - conn->unacked_len);
+/* Estimate of the data still in the network: everything unacknowledged
+ * and not SACKed, except holes that are lost and not yet retransmitted.
+ */
+static uint32_t tcp_sack_pipe(struct tcp *conn)
+{
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+	uint32_t high_data = conn->seq + conn->unacked_len;
+	uint32_t pos = conn->seq;
+	uint32_t pipe = 0U;
+
+	for (int k = 0; k <= sb->num_blocks; k++) {
+		uint32_t hole_end = k < sb->num_blocks ? sb->blocks[k].start : high_data;
+
+		if (net_tcp_seq_greater(hole_end, pos)) {
+			if (k == sb->num_blocks || !tcp_sack_is_lost(conn, k)) {
+				pipe += hole_end - pos;
+			} else if (net_tcp_seq_greater(sb->high_rxt, pos)) {
+				pipe += (net_tcp_seq_greater(hole_end, sb->high_rxt) ?
+					 sb->high_rxt : hole_end) - pos;
+			}
+		}
 
-#ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
-		if (conn->unacked_len >= conn->ca.cwnd) {
-			unsent_len = 0;
-		} else {
-			unsent_len = MIN(unsent_len, conn->ca.cwnd - conn->unacked_len);
+		if (k < sb->num_blocks) {
+			pos = sb->blocks[k].end;
 		}
-#endif
 	}
- out:
-	return unsent_len;
+
+	return pipe;
 }
 
-static int tcp_send_data(struct tcp *conn)
+/* First lost range that has not been retransmitted yet */
+static bool tcp_sack_next_lost(struct tcp *conn, uint32_t *start, uint32_t *end)
 {
-	int ret = 0;
-	int len;
-	struct net_pkt *pkt;
-
-	len = MIN(tcp_unsent_len(conn), conn_mss(conn));
-	if (len < 0) {
-		ret = len;
-		goto out;
-	}
-	if (len == 0) {
-		NET_DBG("conn: %p no data to send", conn);
-		ret = -ENODATA;
-		goto out;
-	}
-
-	pkt = tcp_pkt_alloc(conn, len);
-	if (!pkt) {
-		NET_ERR("conn: %p packet allocation failed, len=%d", conn, len);
-		ret = -ENOBUFS;
-		goto out;
-	}
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+	uint32_t pos = conn->seq;
 
-	ret = tcp_pkt_peek(pkt, conn->send_data, conn->unacked_len, len);
-	if (ret < 0) {
-		tcp_pkt_unref(pkt);
-		ret = -ENOBUFS;
-		goto out;
-	}
+	for (int k = 0; k < sb->num_blocks; k++) {
+		if (net_tcp_seq_greater(sb->high_rxt, pos)) {
+			pos = sb->high_rxt;
+		}
 
-	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + conn->unacked_len);
-	if (ret == 0) {
-		conn->unacked_len += len;
+		if (net_tcp_seq_greater(sb->blocks[k].start, pos) &&
+		    tcp_sack_is_lost(conn, k)) {
+			*start = pos;
+			*end = sb->blocks[k].start;
+			return true;
+		}
 
-		if (conn->data_mode == TCP_DATA_MODE_RESEND) {
-			net_stats_update_tcp_resent(conn->iface, len);
-			net_stats_update_tcp_seg_rexmit(conn->iface);
-		} else {
-			net_stats_update_tcp_sent(conn->iface, len);
-			net_stats_update_tcp_seg_sent(conn->iface);
+		if (net_tcp_seq_greater(sb->blocks[k].end, pos)) {
+			pos = sb->blocks[k].end;
 		}
 	}
 
-	/* The data we want to send, has been moved to the send queue so we
-	 * can unref the head net_pkt. If there was an error, we need to remove
-	 * the packet anyway.
-	 */
-	tcp_pkt_unref(pkt);
-
-	conn_send_data_dump(conn);
+	return false;
+}
 
- out:
-	return ret;
+static uint32_t tcp_sack_cwnd(struct tcp *conn)
+{
+#ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
+	return MIN(conn->ca.cwnd, conn->send_win);
+#else
+	return conn->send_win;
+#endif
 }
 
-/* Send all queued but unsent data from the send_data packet by packet
- * until the receiver's window is full. */
-static int tcp_send_queued_data(struct tcp *conn)
+/* Send what the pipe allows, lost data first and then new data */
+static void tcp_sack_recover(struct tcp *conn)
 {
-	int ret = 0;
-	bool subscribe = false;
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+	int mss = tcp_send_mss(conn);
 
-	if (conn->data_mode == TCP_DATA_MODE_RESEND) {
-		goto out;
-	}
+	while (tcp_sack_pipe(conn) < tcp_sack_cwnd(conn)) {
+		uint32_t start, end;
+		int len;
 
-	while (tcp_unsent_len(conn) > 0) {
-		/* Implement Nagle's algorithm */
-		if ((conn->tcp_nodelay == false) && (conn->unacked_len > 0)) {
-			/* If there is already pending data */
-			if (tcp_unsent_len(conn) < conn_mss(conn)) {
-				/* The number of bytes to be transmitted is less than an MSS,
-				 * skip transmission for now.
-				 * Wait for more data to be transmitted or all pending data
-				 * being acknowledged.
-				 */
+		if (tcp_sack_next_lost(conn, &start, &end)) {
+			len = MIN(end - start, mss);
+
+			if (tcp_send_segment(conn, start - conn->seq, len) < 0) {
 				break;
 			}
+
+			sb->high_rxt = start + len;
+			continue;
 		}
 
-		ret = tcp_send_data(conn);
-		if (ret < 0) {
+		len = conn->send_data_total - conn->unacked_len;
+		len = MIN3(len, (int)conn->send_win - conn->unacked_len, mss);
+		if (len <= 0) {
 			break;
 		}
-	}
 
-	if (conn->send_data_total) {
-		subscribe = true;
+		if (tcp_send_segment(conn, conn->unacked_len, len) < 0) {
+			break;
+		}
+
+		conn->unacked_len += len;
 	}
+}
 
-	if (k_work_delayable_remaining_get(&conn->send_data_timer)) {
-		subscribe = false;
+static void tcp_sack_enter_recovery(struct tcp *conn)
+{
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+
+	NET_DBG("conn: %p SACK recovery, %u blocks", conn, sb->num_blocks);
+
+	sb->in_recovery = true;
+	sb->recovery_point = conn->seq + conn->unacked_len;
+	sb->high_rxt = conn->seq;
+
+	tcp_sack_recover(conn);
+}
+
+/* Returns true when the cumulative acknowledgment was consumed by an
+ * ongoing recovery, so that it does not grow the congestion window.
+ */
+static bool tcp_sack_acked(struct tcp *conn, uint32_t ack)
+{
+	if (!conn->sack.in_recovery) {
+		return false;
 	}
 
-	if (subscribe) {
-		conn->send_data_retries = 0;
-		k_work_reschedule_for_queue(&tcp_work_q, &conn->send_data_timer,
-					    K_MSEC(TCP_RTO_MS));
+	if (net_tcp_seq_cmp(ack, conn->sack.recovery_point) >= 0) {
+		NET_DBG("conn: %p SACK recovery done", conn);
+		conn->sack.in_recovery = false;
+		tcp_ca_recovery_end(conn);
 	}
- out:
-	return ret;
+
+	return true;
 }
 
+#else
+
+static inline void tcp_sack_negotiate(struct tcp *conn) { }
+
+static inline void tcp_sack_syn_options(struct tcp *conn, bool enable) { }
+
+static inline bool tcp_sack_enabled(struct tcp *conn) { return false; }
+
+static inline void tcp_sack_reset(struct tcp *conn) { }
+
+static inline bool tcp_sack_in_recovery(struct tcp *conn) { return false; }
+
+static inline void tcp_sack_update(struct tcp *conn, uint32_t ack) { }
+
+static inline bool tcp_sack_loss_detected(struct tcp *conn) { return false; }
+
+static inline void tcp_sack_recover(struct tcp *conn) { }
+
+static inline void tcp_sack_enter_recovery(struct tcp *conn) { }
+
+static inline bool tcp_sack_acked(struct tcp *conn, uint32_t ack) { return false; }
+
+#endif /* CONFIG_NET_TCP_SACK */
+
 static void tcp_cleanup_recv_queue(struct k_work *work)
 {
 	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
@@ -1860,6 +2767,9 @@ static void tcp_resend_data(struct k_work *work)
 		goto out;
 	}
 
+	/* The peer may have discarded the data it SACKed, RFC 2018 */
+	tcp_sack_reset(conn);
+
 	if (IS_ENABLED(CONFIG_NET_TCP_CONGESTION_AVOIDANCE) &&
 	    (conn->send_data_retries == 0)) {
 		tcp_ca_timeout(conn);
@@ -2119,11 +3029,21 @@ static struct tcp *tcp_conn_alloc(void)
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 	conn->dup_ack_cnt = 0;
 #endif
+#ifdef CONFIG_NET_TCP_SACK
+	/* Offered in the SYN, until the peer tells otherwise */
+	conn->sack_permitted = true;
+#endif
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+	conn->ts_enabled = true;
+	conn->ts_offset = sys_rand32_get();
+	conn->rtt.rto = tcp_rto;
+#endif
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 	/* Initially set the congestion window at its max size, since only the MSS
 	 * is available as soon as the connection is established
 	 */
 	conn->ca.cwnd = UINT16_MAX;
+	conn->ca_ops = TCP_CA_DEFAULT;
 #endif
 
 	/* The ISN value will be set when we get the connection attempt or
@@ -2140,6 +3060,10 @@ static struct tcp *tcp_conn_alloc(void)
 	k_work_init_delayable(&conn->recv_queue_timer, tcp_cleanup_recv_queue);
 	k_work_init_delayable(&conn->persist_timer, tcp_send_zwp);
 	k_work_init_delayable(&conn->ack_timer, tcp_send_ack);
+#ifdef CONFIG_NET_TCP_PACING
+	k_work_init_delayable(&conn->pacing_timer, tcp_pacing_resume);
+	conn->pacing_next_us = 0;
+#endif
 	k_work_init(&conn->conn_release, tcp_conn_release);
 	keep_alive_timer_init(conn);
 
@@ -2528,166 +3452,89 @@ static enum tcp_state tcp_enter_time_wait(struct tcp *conn)
 	return TCP_TIME_WAIT;
 }
 
-static bool check_seq_list(struct net_buf *buf)
-{
-	struct net_buf *last = NULL;
-	struct net_buf *tmp = buf;
-	uint32_t seq;
-	uint32_t next_seq = 0;
-	bool result = true;
-
-	while (tmp) {
-		seq = tcp_get_seq(tmp);
-
-		NET_DBG("buf %p seq %u len %d", tmp, seq, tmp->len);
-
-		if (last != NULL) {
-			if (next_seq != seq) {
-				result = false;
-			}
-		}
-
-		next_seq = seq + tmp->len;
-		last = tmp;
-		tmp = tmp->frags;
-	}
-	return result;
-}
-
 static void tcp_queue_recv_data(struct tcp *conn, struct net_pkt *pkt,
 				size_t len, uint32_t seq)
 {
 	uint32_t seq_start = seq;
-	bool inserted = false;
+	uint32_t end = seq + len;
+	struct net_buf *prev = NULL;
 	struct net_buf *tmp;
+	uint32_t pending_seq;
+	uint32_t pending_end;
 
 	NET_DBG("conn: %p len %zd seq %u ack %u", conn, len, seq, conn->ack);
 
-	tmp = pkt->buffer;
-
-	tcp_set_seq(tmp, seq);
-	seq += tmp->len;
-	tmp = tmp->frags;
-
-	while (tmp) {
-		tcp_set_seq(tmp, seq);
-		seq += tmp->len;
-		tmp = tmp->frags;
-	}
-
-	if (IS_ENABLED(CONFIG_NET_TCP_LOG_LEVEL_DBG)) {
-		NET_DBG("Queuing data: conn %p", conn);
-	}
-
-	if (!net_pkt_is_empty(conn->queue_recv_data)) {
-		/* Place the data to correct place in the list. If the data
-		 * would not be sequential, then drop this packet.
-		 *
-		 * Only work with subtractions between sequence numbers in uint32_t format
-		 * to proper handle cases that are around the wrapping point.
-		 */
-
-		/* Some potentential cases:
-		 * Note: MI = MAX_INT
-		 * Packet | Queued| End off1  | Start off| End off2    | Required handling
-		 * Seq|Len|Seq|Len|           |          |             |
-		 *  3 | 3 | 6 | 4 | 3+3-6=  0 | NA       | NA          | Prepend
-		 *  3 | 4 | 6 | 4 | 3+4-6 = 1 | NA       | NA          | Prepend, pull from buffer
-		 *  3 | 7 | 6 | 4 | 3+7-6 = 4 | 6-3=3    | 6+4-3=7     | Drop queued data
-		 *  3 | 8 | 6 | 4 | 3+8-6 = 5 | 6-3=3    | 6+4-3=7     | Drop queued data
-		 *  6 | 5 | 6 | 4 | 6+5-6 = 5 | 6-6=0    | 6+4-6=4     | Drop queued data
-		 *  6 | 4 | 6 | 4 | 6+4-6 = 4 | 6-6=0    | 6+4-6=4     | Drop queued data / packet
-		 *  7 | 2 | 6 | 4 | 7+2-6 = 3 | 6-7=MI   | 6+4-7=3     | Drop packet
-		 * 10 | 2 | 6 | 4 | 10+2-6= 6 | 6-10=MI-3| 6+4-10=0    | Append
-		 *  7 | 4 | 6 | 4 | 7+4-6 = 5 | 6-7 =MI  | 6+4-7 =3    | Append, pull from packet
-		 * 11 | 2 | 6 | 4 | 11+2-6= 7 | 6-11=MI-6| 6+4-11=MI-1 | Drop incoming packet
-		 *  2 | 3 | 6 | 4 | 2+3-6= MI | 6-2=4    | 6+4-2=8     | Drop incoming packet
-		 */
-
-		uint32_t pending_seq;
-		uint32_t start_offset;
-		uint32_t end_offset;
-		size_t pending_len;
-
-		pending_seq = tcp_get_seq(conn->queue_recv_data->buffer);
-		end_offset = seq - pending_seq;
-		pending_len = net_pkt_get_len(conn->queue_recv_data);
-		if (end_offset < pending_len) {
-			if (end_offset < len) {
-				if (end_offset) {
-					net_pkt_remove_tail(pkt, end_offset);
-				}
-
-				/* Put new data before the pending data */
-				net_buf_frag_add(pkt->buffer,
-						 conn->queue_recv_data->buffer);
-				NET_DBG("Adding at before queue, end_offset %i, pending_len %zu",
-					end_offset, pending_len);
-				conn->queue_recv_data->buffer = pkt->buffer;
-				inserted = true;
+	/* Find the place of the data in the queue, keeping the queued data
+	 * where the new data overlaps it, and dropping the queued buffers it
+	 * covers entirely.
+	 *
+	 * Only work with subtractions between sequence numbers in uint32_t format
+	 * to proper handle cases that are around the wrapping point.
+	 */
+	tmp = conn->queue_recv_data->buffer;
+	while (tmp != NULL) {
+		pending_seq = tcp_get_seq(tmp);
+		pending_end = pending_seq + tmp->len;
+
+		if (net_tcp_seq_cmp(pending_end, seq) <= 0) {
+			/* Queued data before the new data */
+			prev = tmp;
+			tmp = tmp->frags;
+		} else if (net_tcp_seq_cmp(pending_seq, end) >= 0) {
+			/* Queued data after the new data */
+			break;
+		} else if (net_tcp_seq_cmp(pending_seq, seq) <= 0) {
+			if (net_tcp_seq_cmp(pending_end, end) >= 0) {
+				NET_DBG("conn: %p data already queued", conn);
+				goto out;
 			}
-		} else {
-			struct net_buf *last;
-
-			last = net_buf_frag_last(conn->queue_recv_data->buffer);
-			pending_seq = tcp_get_seq(last);
-
-			start_offset = pending_seq - seq_start;
-			/* Compute the offset w.r.t. the start point of the new packet */
-			end_offset = (pending_seq + last->len) - seq_start;
-
-			/* Check if queue start with within the within the new packet */
-			if ((start_offset < len) && (end_offset <= len)) {
-				/* The queued data is irrelevant since the new packet overlaps the
-				 * new packet, take the new packet as contents
-				 */
-				net_buf_unref(conn->queue_recv_data->buffer);
-				conn->queue_recv_data->buffer = pkt->buffer;
-				inserted = true;
-			} else {
-				if (end_offset < len) {
-					if (end_offset) {
-						net_pkt_remove_tail(conn->queue_recv_data,
-								    end_offset);
-					}
 
-					/* Put new data after pending data */
-					NET_DBG("Adding at end of queue, start %i, end %i, len %zu",
-						start_offset, end_offset, len);
-					net_buf_frag_add(conn->queue_recv_data->buffer,
-							 pkt->buffer);
-					inserted = true;
-				}
+			/* Queued data overlapping the start of the new data */
+			tcp_pkt_pull(pkt, pending_end - seq);
+			seq = pending_end;
+			prev = tmp;
+			tmp = tmp->frags;
+		} else if (net_tcp_seq_cmp(pending_end, end) > 0) {
+			/* Queued data overlapping the end of the new data */
+			net_pkt_remove_tail(pkt, end - pending_seq);
+			end = pending_seq;
+			break;
+		} else {
+			/* Queued data within the new data */
+			tmp = net_buf_frag_del(prev, tmp);
+			if (prev == NULL) {
+				conn->queue_recv_data->buffer = tmp;
 			}
 		}
+	}
 
-		if (inserted) {
-			NET_DBG("All pending data: conn %p", conn);
-			if (check_seq_list(conn->queue_recv_data->buffer) == false) {
-				NET_ERR("Incorrect order in out of order sequence for conn %p",
-					conn);
-				/* error in sequence list, drop it */
-				net_buf_unref(conn->queue_recv_data->buffer);
-				conn->queue_recv_data->buffer = NULL;
-			}
-		} else {
-			NET_DBG("Cannot add new data to queue");
-		}
+	NET_DBG("Adding seq %u len %u to the queue of conn %p", seq, end - seq, conn);
+
+	for (tmp = pkt->buffer, pending_seq = seq; tmp != NULL; tmp = tmp->frags) {
+		tcp_set_seq(tmp, pending_seq);
+		pending_seq += tmp->len;
+	}
+
+	if (prev != NULL) {
+		net_buf_frag_insert(prev, pkt->buffer);
 	} else {
-		net_pkt_append_buffer(conn->queue_recv_data, pkt->buffer);
-		inserted = true;
+		if (conn->queue_recv_data->buffer != NULL) {
+			net_buf_frag_add(pkt->buffer, conn->queue_recv_data->buffer);
+		}
+		conn->queue_recv_data->buffer = pkt->buffer;
 	}
 
-	if (inserted) {
-		/* We need to keep the received data but free the pkt */
-		pkt->buffer = NULL;
+	/* We need to keep the received data but free the pkt */
+	pkt->buffer = NULL;
 
-		if (!k_work_delayable_is_pending(&conn->recv_queue_timer)) {
-			k_work_reschedule_for_queue(
-				&tcp_work_q, &conn->recv_queue_timer,
-				K_MSEC(CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT));
-		}
+	if (!k_work_delayable_is_pending(&conn->recv_queue_timer)) {
+		k_work_reschedule_for_queue(
+			&tcp_work_q, &conn->recv_queue_timer,
+			K_MSEC(CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT));
 	}
+
+out:
+	tcp_sack_recv_add(conn, seq_start);
 }
 
 static enum net_verdict tcp_data_received(struct tcp *conn, struct net_pkt *pkt,
@@ -2822,7 +3669,10 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 	}
 
 	if (FL(&fl, &, RST)) {
-		/* We only accept RST packet that has valid seq field. */
+		/* We only accept RST packet that has valid seq field. Its
+		 * timestamp is not checked (RFC 7323 ch 5.2): this is done
+		 * before the PAWS test below.
+		 */
 		if (!tcp_validate_seq(conn, th)) {
 			net_stats_update_tcp_seg_rsterr(net_pkt_iface(pkt));
 			k_mutex_unlock(&conn->lock);
@@ -2849,6 +3699,11 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		goto out;
 	}
 
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+	/* A timestamp is only valid for the segment carrying it */
+	conn->recv_options.ts_found = false;
+#endif
+
 	if (tcp_options_len && !tcp_options_check(&conn->recv_options, pkt,
 						  tcp_options_len)) {
 		NET_DBG("DROP: Invalid TCP option list");
@@ -2873,6 +3728,14 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		goto out;
 	}
 
+	if (th && (conn->state != TCP_LISTEN) && (conn->state != TCP_SYN_SENT) &&
+	    !tcp_ts_accept(conn, th)) {
+		NET_DBG("conn: %p, old timestamp, dropping segment", conn);
+		net_stats_update_tcp_seg_drop(conn->iface);
+		tcp_out(conn, ACK);
+		goto out;
+	}
+
 	if (th) {
 		conn->send_win = ntohs(th_win(th));
 		if (conn->send_win > conn->send_win_max) {
@@ -2908,9 +3771,13 @@ next_state:
 		if (FL(&fl, ==, SYN)) {
 			/* Make sure our MSS is also sent in the ACK */
 			conn->send_options.mss_found = true;
+			tcp_ts_negotiate(conn);
+			tcp_sack_negotiate(conn);
+			tcp_sack_syn_options(conn, true);
 			conn_ack(conn, th_seq(th) + 1); /* capture peer's isn */
 			tcp_out(conn, SYN | ACK);
 			conn->send_options.mss_found = false;
+			tcp_sack_syn_options(conn, false);
 			conn_seq(conn, + 1);
 			next = TCP_SYN_RECEIVED;
 
@@ -2922,8 +3789,10 @@ next_state:
 			verdict = NET_OK;
 		} else {
 			conn->send_options.mss_found = true;
+			tcp_sack_syn_options(conn, true);
 			tcp_out(conn, SYN);
 			conn->send_options.mss_found = false;
+			tcp_sack_syn_options(conn, false);
 			conn_seq(conn, + 1);
 			next = TCP_SYN_SENT;
 			tcp_conn_ref(conn);
@@ -2939,10 +3808,14 @@ next_state:
 				accept_cb = conn->accepted_conn->accept_cb;
 				context = conn->accepted_conn->context;
 				keep_alive_param_copy(conn, conn->accepted_conn);
+#ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
+				conn->ca_ops = conn->accepted_conn->ca_ops;
+#endif
 			}
 
 			k_work_cancel_delayable(&conn->establish_timer);
 			tcp_send_timer_cancel(conn);
+			tcp_ts_rtt_sample(conn);
 			tcp_conn_ref(conn);
 			net_context_set_state(conn->context,
 					      NET_CONTEXT_CONNECTED);
@@ -3028,6 +3901,9 @@ next_state:
 		 */
 		if (FL(&fl, &, SYN | ACK, th && th_ack(th) == conn->seq)) {
 			tcp_send_timer_cancel(conn);
+			tcp_ts_negotiate(conn);
+			tcp_ts_rtt_sample(conn);
+			tcp_sack_negotiate(conn);
 			conn_ack(conn, th_seq(th) + 1);
 			if (len) {
 				verdict = tcp_data_get(conn, pkt, &len);
@@ -3111,6 +3987,10 @@ next_state:
 		 */
 		keep_alive_timer_restart(conn);
 
+		if (th) {
+			tcp_sack_update(conn, th_ack(th));
+		}
+
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 		if (th && (net_tcp_seq_cmp(th_ack(th), conn->seq) == 0)) {
 			/* Only if there is pending data, increment the duplicate ack count */
@@ -3122,15 +4002,31 @@ next_state:
 					 */
 					conn->dup_ack_cnt = MIN(conn->dup_ack_cnt + 1,
 						DUPLICATE_ACK_RETRANSMIT_TRHESHOLD + 1);
-					tcp_ca_dup_ack(conn);
+					if (!tcp_sack_in_recovery(conn)) {
+						tcp_ca_dup_ack(conn);
+					}
 				}
 			} else {
 				conn->dup_ack_cnt = 0;
 			}
 
 			/* Only do fast retransmit when not already in a resend state */
-			if ((conn->data_mode == TCP_DATA_MODE_SEND) &&
-			    (conn->dup_ack_cnt == DUPLICATE_ACK_RETRANSMIT_TRHESHOLD)) {
+			if (tcp_sack_in_recovery(conn)) {
+				/* Newly SACKed data may allow sending more */
+				tcp_sack_recover(conn);
+			} else if ((conn->data_mode == TCP_DATA_MODE_SEND) &&
+				   tcp_sack_enabled(conn)) {
+				if ((conn->dup_ack_cnt == DUPLICATE_ACK_RETRANSMIT_TRHESHOLD) ||
+				    tcp_sack_loss_detected(conn)) {
+					/* Retransmit only what the peer is missing */
+					tcp_ca_fast_retransmit(conn);
+					tcp_sack_enter_recovery(conn);
+					if (tcp_window_full(conn)) {
+						(void)k_sem_take(&conn->tx_sem, K_NO_WAIT);
+					}
+				}
+			} else if ((conn->data_mode == TCP_DATA_MODE_SEND) &&
+				   (conn->dup_ack_cnt == DUPLICATE_ACK_RETRANSMIT_TRHESHOLD)) {
 				/* Apply a fast retransmit */
 				int temp_unacked_len = conn->unacked_len;
 
@@ -3175,7 +4071,14 @@ next_state:
 			/* New segment, reset duplicate ack counter */
 			conn->dup_ack_cnt = 0;
 #endif
-			tcp_ca_pkts_acked(conn, len_acked);
+			/* Sample first, the algorithm may model the path RTT */
+			tcp_ts_rtt_sample(conn);
+
+			if (!tcp_sack_acked(conn, th_ack(th))) {
+				tcp_ca_pkts_acked(conn, len_acked);
+			} else {
+				tcp_ca_delivered(conn, len_acked);
+			}
 
 			conn->send_data_total -= len_acked;
 			if (conn->unacked_len < len_acked) {
@@ -3235,6 +4138,10 @@ next_state:
 				break;
 			}
 
+			if (tcp_sack_in_recovery(conn)) {
+				tcp_sack_recover(conn);
+			}
+
 			if (tcp_window_full(conn)) {
 				(void)k_sem_take(&conn->tx_sem, K_NO_WAIT);
 			}
@@ -4427,6 +5334,9 @@ int net_tcp_set_option(struct net_context *context,
 	case TCP_OPT_KEEPCNT:
 		ret = set_tcp_keep_cnt(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+		ret = set_tcp_congestion(conn, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
@@ -4464,6 +5374,9 @@ int net_tcp_get_option(struct net_context *context,
 	case TCP_OPT_KEEPCNT:
 		ret = get_tcp_keep_cnt(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+		ret = get_tcp_congestion(conn, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
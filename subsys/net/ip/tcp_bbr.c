@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Simplified BBR congestion control.
+ *
+ * The path is modelled by its bottleneck bandwidth, the maximum delivery
+ * rate seen over the last rounds, and its minimum round trip time. The
+ * sender is paced at a multiple of the bandwidth and keeps about two
+ * bandwidth-delay products in flight. Losses do not reduce the window.
+ *
+ * Compared to the full algorithm the delivery rate is measured once per
+ * round trip instead of per segment, there is no application limited
+ * detection and no long term bandwidth sampling.
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include "tcp_internal.h"
+
+enum bbr_mode {
+	BBR_STARTUP,
+	BBR_DRAIN,
+	BBR_PROBE_BW,
+	BBR_PROBE_RTT,
+};
+
+/* Gains are in units of 1/256 */
+#define BBR_UNIT 256
+#define BBR_HIGH_GAIN (BBR_UNIT * 2885 / 1000 + 1) /* 2 / ln(2) */
+#define BBR_DRAIN_GAIN (BBR_UNIT * 1000 / 2885)
+#define BBR_CWND_GAIN (BBR_UNIT * 2)
+
+/* Bandwidth has stopped growing when it is up less than 25% in 3 rounds */
+#define BBR_FULL_BW_THRESH (BBR_UNIT * 5 / 4)
+#define BBR_FULL_BW_CNT 3
+
+#define BBR_MIN_RTT_WIN_MS 10000
+#define BBR_PROBE_RTT_MS 200
+#define BBR_MIN_CWND_SEGS 4U
+
+/* Probe for more bandwidth, drain the queue it built, then cruise */
+static const uint16_t bbr_pacing_gain[] = {
+	BBR_UNIT * 5 / 4, BBR_UNIT * 3 / 4,
+	BBR_UNIT, BBR_UNIT, BBR_UNIT, BBR_UNIT, BBR_UNIT, BBR_UNIT,
+};
+
+static const char *const bbr_mode_str[] = {
+	[BBR_STARTUP] = "startup",
+	[BBR_DRAIN] = "drain",
+	[BBR_PROBE_BW] = "probe_bw",
+	[BBR_PROBE_RTT] = "probe_rtt",
+};
+
+static void bbr_log(struct tcp *conn, char *step)
+{
+	struct tcp_ca_bbr *b = &conn->ca_priv.bbr;
+
+	NET_DBG("conn: %p, bbr %s, %s, cwnd=%d, btl_bw=%u, min_rtt=%u",
+		conn, step, bbr_mode_str[b->mode], conn->ca.cwnd,
+		b->btl_bw, b->min_rtt);
+}
+
+static bool bbr_full_bw_reached(struct tcp_ca_bbr *b)
+{
+	return b->full_bw_cnt >= BBR_FULL_BW_CNT;
+}
+
+/* Bandwidth-delay product scaled by gain, in bytes */
+static uint32_t bbr_bdp(struct tcp_ca_bbr *b, uint32_t gain)
+{
+	uint64_t bdp = (uint64_t)b->btl_bw * b->min_rtt / MSEC_PER_SEC;
+
+	return (uint32_t)MIN(bdp * gain / BBR_UNIT, UINT32_MAX);
+}
+
+/* RTT of the segment just acknowledged, 0 when it is not known */
+static uint32_t bbr_rtt_sample(struct tcp *conn)
+{
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+	if (conn->ts_enabled && conn->recv_options.ts_found) {
+		return MAX(conn->rtt.last, 1U);
+	}
+#endif
+	return 0U;
+}
+
+static void bbr_update_min_rtt(struct tcp *conn, int64_t now, uint32_t rtt)
+{
+	struct tcp_ca_bbr *b = &conn->ca_priv.bbr;
+	bool expired = (now - b->min_rtt_stamp) > BBR_MIN_RTT_WIN_MS;
+
+	if (b->min_rtt == 0U || rtt <= b->min_rtt || expired) {
+		b->min_rtt = rtt;
+		b->min_rtt_stamp = now;
+	}
+
+	/* Let the queue drain to see the propagation delay again */
+	if (expired && b->mode != BBR_PROBE_RTT) {
+		b->mode = BBR_PROBE_RTT;
+		b->probe_rtt_done = now + BBR_PROBE_RTT_MS;
+		bbr_log(conn, "enter");
+	}
+}
+
+static void bbr_round_end(struct tcp *conn, int64_t now)
+{
+	struct tcp_ca_bbr *b = &conn->ca_priv.bbr;
+	uint32_t elapsed = MAX((uint32_t)(now - b->round_start), 1U);
+	uint32_t bw = 0U;
+
+	/* Without timestamps a round is the best estimate of the RTT */
+	if (bbr_rtt_sample(conn) == 0U) {
+		bbr_update_min_rtt(conn, now, elapsed);
+	}
+
+	b->bw[b->rounds % TCP_BBR_BW_FILTER_LEN] =
+		(uint64_t)b->round_delivered * MSEC_PER_SEC / elapsed;
+	b->rounds++;
+
+	ARRAY_FOR_EACH(b->bw, i) {
+		bw = MAX(bw, b->bw[i]);
+	}
+
+	b->btl_bw = bw;
+	b->round_start = now;
+	b->round_delivered = 0U;
+	b->round_end_seq = conn->seq + conn->unacked_len;
+
+	if (b->mode == BBR_STARTUP) {
+		if ((uint64_t)bw * BBR_UNIT >=
+		    (uint64_t)b->full_bw * BBR_FULL_BW_THRESH) {
+			b->full_bw = bw;
+			b->full_bw_cnt = 0U;
+		} else if (++b->full_bw_cnt >= BBR_FULL_BW_CNT) {
+			b->mode = BBR_DRAIN;
+			bbr_log(conn, "enter");
+		}
+	} else if (b->mode == BBR_PROBE_BW) {
+		b->cycle_idx = (b->cycle_idx + 1U) % ARRAY_SIZE(bbr_pacing_gain);
+	}
+}
+
+static void bbr_update_mode(struct tcp *conn, int64_t now, uint32_t inflight)
+{
+	struct tcp_ca_bbr *b = &conn->ca_priv.bbr;
+
+	if (b->mode == BBR_DRAIN && inflight <= bbr_bdp(b, BBR_UNIT)) {
+		b->mode = BBR_PROBE_BW;
+		b->cycle_idx = 2U;
+		bbr_log(conn, "enter");
+	} else if (b->mode == BBR_PROBE_RTT && now >= b->probe_rtt_done) {
+		b->min_rtt_stamp = now;
+		b->mode = bbr_full_bw_reached(b) ? BBR_PROBE_BW : BBR_STARTUP;
+		bbr_log(conn, "enter");
+	}
+}
+
+static void bbr_set_cwnd(struct tcp *conn, uint32_t acked_len)
+{
+	struct tcp_ca_bbr *b = &conn->ca_priv.bbr;
+	uint32_t min_cwnd = BBR_MIN_CWND_SEGS * conn_mss(conn);
+	uint32_t cwnd = conn->ca.cwnd;
+	uint32_t target;
+
+	if (b->mode == BBR_PROBE_RTT) {
+		conn->ca.cwnd = MIN(cwnd, min_cwnd);
+		return;
+	}
+
+	target = bbr_bdp(b, bbr_full_bw_reached(b) ? BBR_CWND_GAIN :
+			 BBR_HIGH_GAIN);
+	target = MAX(target, min_cwnd);
+
+	if (bbr_full_bw_reached(b)) {
+		cwnd = MIN(cwnd + acked_len, target);
+	} else if (cwnd < target || b->btl_bw == 0U) {
+		cwnd += acked_len;
+	}
+
+	conn->ca.cwnd = CLAMP(cwnd, MIN(min_cwnd, UINT16_MAX), UINT16_MAX);
+}
+
+static void bbr_init(struct tcp *conn)
+{
+	struct tcp_ca_bbr *b = &conn->ca_priv.bbr;
+	int64_t now = k_uptime_get();
+
+	memset(b, 0, sizeof(*b));
+	b->mode = BBR_STARTUP;
+	b->round_start = now;
+	b->min_rtt_stamp = now;
+	b->round_end_seq = conn->seq + conn->unacked_len;
+
+	conn->ca.cwnd = TCP_CA_INITIAL_WIN(conn_mss(conn));
+	conn->ca.ssthresh = UINT16_MAX;
+	conn->ca.pending_fast_retransmit_bytes = 0;
+	bbr_log(conn, "init");
+}
+
+/* Update the path model from acked_len newly delivered bytes */
+static void bbr_update_model(struct tcp *conn, uint32_t acked_len)
+{
+	struct tcp_ca_bbr *b = &conn->ca_priv.bbr;
+	uint32_t rtt = bbr_rtt_sample(conn);
+	uint32_t inflight = conn->unacked_len - MIN(conn->unacked_len, acked_len);
+	int64_t now = k_uptime_get();
+
+	b->round_delivered += acked_len;
+
+	if (rtt > 0U) {
+		bbr_update_min_rtt(conn, now, rtt);
+	}
+
+	if (net_tcp_seq_cmp(conn->seq + acked_len, b->round_end_seq) >= 0) {
+		bbr_round_end(conn, now);
+	}
+
+	bbr_update_mode(conn, now, inflight);
+}
+
+static void bbr_on_ack(struct tcp *conn, uint32_t acked_len)
+{
+	bbr_update_model(conn, acked_len);
+	bbr_set_cwnd(conn, acked_len);
+	bbr_log(conn, "pkts_acked");
+}
+
+/* The rounds keep counting during SACK recovery, the window is left to it */
+static void bbr_on_delivered(struct tcp *conn, uint32_t acked_len)
+{
+	bbr_update_model(conn, acked_len);
+	bbr_log(conn, "delivered");
+}
+
+static void bbr_on_dup_ack(struct tcp *conn) { }
+
+/* Losses are not taken as a congestion signal and the window is left
+ * as is. Retransmissions bypass the pacing timer: the fast retransmit is
+ * sent right away from tcp_in(), and SACK recovery sends as long as the
+ * pipe is below the window.
+ */
+static void bbr_on_loss(struct tcp *conn)
+{
+	bbr_log(conn, "fast_retransmit");
+}
+
+static void bbr_on_recovery_end(struct tcp *conn) { }
+
+static void bbr_on_rto(struct tcp *conn)
+{
+	conn->ca.cwnd = MIN(BBR_MIN_CWND_SEGS * conn_mss(conn), UINT16_MAX);
+	bbr_log(conn, "timeout");
+}
+
+static uint32_t bbr_pacing_rate(struct tcp *conn)
+{
+	struct tcp_ca_bbr *b = &conn->ca_priv.bbr;
+	uint32_t gain;
+
+	/* No estimate yet, don't pace and send as fast as the window allows */
+	if (b->btl_bw == 0U) {
+		return 0U;
+	}
+
+	switch (b->mode) {
+	case BBR_STARTUP:
+		gain = BBR_HIGH_GAIN;
+		break;
+	case BBR_DRAIN:
+		gain = BBR_DRAIN_GAIN;
+		break;
+	case BBR_PROBE_BW:
+		gain = bbr_pacing_gain[b->cycle_idx];
+		break;
+	default:
+		gain = BBR_UNIT;
+		break;
+	}
+
+	return (uint32_t)MIN((uint64_t)b->btl_bw * gain / BBR_UNIT, UINT32_MAX);
+}
+
+const struct tcp_ca_ops tcp_ca_bbr = {
+	.name = "bbr",
+	.init = bbr_init,
+	.on_ack = bbr_on_ack,
+	.on_dup_ack = bbr_on_dup_ack,
+	.on_loss = bbr_on_loss,
+	.on_delivered = bbr_on_delivered,
+	.on_recovery_end = bbr_on_recovery_end,
+	.on_rto = bbr_on_rto,
+	.pacing_rate = bbr_pacing_rate,
+};
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* CUBIC congestion control, RFC 9438.
+ *
+ * Outside of slow start the window follows
+ * W(t) = C * (t - K)^3 + W_max, where t is the time since the last
+ * reduction, so it recovers quickly to the window at which the last loss
+ * happened, stays there for a while and then probes for more. Loss
+ * recovery itself is the NewReno fast recovery (RFC 6582).
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include "tcp_internal.h"
+
+/* Multiplicative decrease factor beta = 0.7 */
+#define CUBIC_BETA_NUM 7
+#define CUBIC_BETA_DEN 10
+
+/* Additive increase of the Reno friendly estimate,
+ * alpha = 3 * (1 - beta) / (1 + beta)
+ */
+#define CUBIC_ALPHA_NUM 9
+#define CUBIC_ALPHA_DEN 17
+
+/* Bound of |t - K| in the window function, keeps the cube in range */
+#define CUBIC_T_MAX_MS 60000
+
+static void cubic_log(struct tcp *conn, char *step)
+{
+	NET_DBG("conn: %p, cubic %s, cwnd=%d, ssthres=%d, w_max=%u, k=%u",
+		conn, step, conn->ca.cwnd, conn->ca.ssthresh,
+		conn->ca_priv.cubic.w_max, conn->ca_priv.cubic.k);
+}
+
+static uint32_t cubic_root(uint64_t a)
+{
+	uint64_t y = 0;
+
+	for (int s = 63; s >= 0; s -= 3) {
+		uint64_t b;
+
+		y <<= 1;
+		b = 3 * y * (y + 1) + 1;
+		if ((a >> s) >= b) {
+			a -= b << s;
+			y++;
+		}
+	}
+
+	return (uint32_t)y;
+}
+
+/* W(t) in bytes, t in milliseconds. With C = 0.4 segments per second
+ * cubed, C * mss * (t / 1000)^3 = (t^3 / 10^6) * 4 * mss / 10^4
+ */
+static uint32_t cubic_window(struct tcp_ca_cubic *c, uint32_t mss, int64_t t)
+{
+	int64_t d = CLAMP(t - (int64_t)c->k, -CUBIC_T_MAX_MS, CUBIC_T_MAX_MS);
+	int64_t w = (int64_t)c->origin + d * d * d / 1000000 * 4 * mss / 10000;
+
+	return (uint32_t)CLAMP(w, (int64_t)mss, (int64_t)UINT16_MAX);
+}
+
+/* The target is the window one RTT ahead, if the RTT is known */
+static uint32_t cubic_rtt(struct tcp *conn)
+{
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+	if (conn->ts_enabled && conn->rtt.samples > 0U) {
+		return conn->rtt.srtt >> 3;
+	}
+#endif
+	return 0U;
+}
+
+static void cubic_reduce(struct tcp *conn)
+{
+	struct tcp_ca_cubic *c = &conn->ca_priv.cubic;
+	uint32_t cwnd = conn->ca.cwnd;
+
+	/* Fast convergence, release bandwidth to newer flows */
+	if (cwnd < c->w_max) {
+		c->w_max = cwnd * (CUBIC_BETA_DEN + CUBIC_BETA_NUM) /
+			   (2 * CUBIC_BETA_DEN);
+	} else {
+		c->w_max = cwnd;
+	}
+
+	conn->ca.ssthresh = MAX(cwnd * CUBIC_BETA_NUM / CUBIC_BETA_DEN,
+				2U * conn_mss(conn));
+	c->epoch_start = 0;
+}
+
+static void cubic_init(struct tcp *conn)
+{
+	struct tcp_ca_cubic *c = &conn->ca_priv.cubic;
+
+	memset(c, 0, sizeof(*c));
+	conn->ca.cwnd = TCP_CA_INITIAL_WIN(conn_mss(conn));
+	conn->ca.ssthresh = UINT16_MAX;
+	conn->ca.pending_fast_retransmit_bytes = 0;
+	cubic_log(conn, "init");
+}
+
+static void cubic_on_ack(struct tcp *conn, uint32_t acked_len)
+{
+	struct tcp_ca_cubic *c = &conn->ca_priv.cubic;
+	uint32_t mss = conn_mss(conn);
+	uint32_t cwnd = conn->ca.cwnd;
+	uint32_t target;
+	uint32_t inc;
+	int64_t now;
+
+	if (conn->ca.pending_fast_retransmit_bytes > 0) {
+		/* Check if it is still in fast recovery mode */
+		if (conn->ca.pending_fast_retransmit_bytes <= acked_len) {
+			conn->ca.pending_fast_retransmit_bytes = 0;
+			conn->ca.cwnd = conn->ca.ssthresh;
+		} else {
+			conn->ca.pending_fast_retransmit_bytes -= acked_len;
+			conn->ca.cwnd = MAX(cwnd - MIN(cwnd, acked_len), mss);
+		}
+
+		cubic_log(conn, "recovery");
+		return;
+	}
+
+	if (cwnd < conn->ca.ssthresh) {
+		conn->ca.cwnd = MIN(cwnd + MIN(acked_len, mss), UINT16_MAX);
+		cubic_log(conn, "slow_start");
+		return;
+	}
+
+	now = k_uptime_get();
+	if (c->epoch_start == 0) {
+		c->epoch_start = now;
+		if (cwnd < c->w_max) {
+			/* K = cbrt((W_max - cwnd) / C), in milliseconds */
+			c->k = cubic_root((uint64_t)(c->w_max - cwnd) *
+					  2500000000ULL / mss);
+			c->origin = c->w_max;
+		} else {
+			c->k = 0;
+			c->origin = cwnd;
+		}
+
+		c->w_est = cwnd;
+	}
+
+	target = cubic_window(c, mss, now - c->epoch_start + cubic_rtt(conn));
+	target = MIN(target, cwnd + cwnd / 2);
+
+	/* Do not grow slower than Reno would */
+	c->w_est += (uint64_t)acked_len * mss * CUBIC_ALPHA_NUM /
+		    ((uint64_t)cwnd * CUBIC_ALPHA_DEN);
+	target = MAX(target, MIN(c->w_est, UINT16_MAX));
+
+	if (target > cwnd) {
+		/* Implement a div_ceil to avoid rounding to 0 */
+		inc = DIV_ROUND_UP((uint64_t)(target - cwnd) * acked_len, cwnd);
+	} else {
+		/* Plateau around W_max, probe very slowly */
+		inc = (uint64_t)acked_len * mss / (100U * cwnd);
+	}
+
+	conn->ca.cwnd = MIN(cwnd + inc, UINT16_MAX);
+	cubic_log(conn, "pkts_acked");
+}
+
+/* Inflate the window by the segment that left the network */
+static void cubic_on_dup_ack(struct tcp *conn)
+{
+	conn->ca.cwnd = MIN(conn->ca.cwnd + conn_mss(conn), UINT16_MAX);
+	cubic_log(conn, "dup_ack");
+}
+
+static void cubic_on_loss(struct tcp *conn)
+{
+	if (conn->ca.pending_fast_retransmit_bytes != 0) {
+		return;
+	}
+
+	cubic_reduce(conn);
+	/* Account for the segments that triggered the duplicate ACKs */
+	conn->ca.cwnd = MIN(conn->ca.ssthresh + 3U * conn_mss(conn), UINT16_MAX);
+	conn->ca.pending_fast_retransmit_bytes = conn->unacked_len;
+	cubic_log(conn, "fast_retransmit");
+}
+
+static void cubic_on_recovery_end(struct tcp *conn)
+{
+	conn->ca.pending_fast_retransmit_bytes = 0;
+	conn->ca.cwnd = conn->ca.ssthresh;
+	cubic_log(conn, "recovery_end");
+}
+
+static void cubic_on_rto(struct tcp *conn)
+{
+	cubic_reduce(conn);
+	conn->ca.cwnd = conn_mss(conn);
+	conn->ca.pending_fast_retransmit_bytes = 0;
+	cubic_log(conn, "timeout");
+}
+
+const struct tcp_ca_ops tcp_ca_cubic = {
+	.name = "cubic",
+	.init = cubic_init,
+	.on_ack = cubic_on_ack,
+	.on_dup_ack = cubic_on_dup_ack,
+	.on_loss = cubic_on_loss,
+	.on_recovery_end = cubic_on_recovery_end,
+	.on_rto = cubic_on_rto,
+};
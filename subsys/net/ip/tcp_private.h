@@ -227,20 +227,81 @@ union tcp_endpoint {
 #define NET_TCP_NOP_OPT          1
 #define NET_TCP_MSS_OPT          2
 #define NET_TCP_WINDOW_SCALE_OPT 3
+#define NET_TCP_SACK_PERM_OPT    4
+#define NET_TCP_SACK_OPT         5
+#define NET_TCP_TIMESTAMP_OPT    8
 
 /* TCP Option sizes */
 #define NET_TCP_END_SIZE          1
 #define NET_TCP_NOP_SIZE          1
 #define NET_TCP_MSS_SIZE          4
 #define NET_TCP_WINDOW_SCALE_SIZE 3
+#define NET_TCP_SACK_PERM_SIZE    2
+#define NET_TCP_SACK_BLOCK_SIZE   8
+#define NET_TCP_TIMESTAMP_SIZE    10
+
+/* Space for the options in the TCP header */
+#define NET_TCP_MAX_OPT_SIZE      40
+
+/* At most four SACK blocks fit in the TCP options */
+#define NET_TCP_SACK_MAX_BLOCKS   4
+
+struct tcp_sack_block {
+	uint32_t start;
+	uint32_t end;
+};
 
 struct tcp_options {
 	uint16_t mss;
 	uint16_t window;
+#ifdef CONFIG_NET_TCP_SACK
+	struct tcp_sack_block sack[NET_TCP_SACK_MAX_BLOCKS];
+	uint8_t sack_blocks;
+#endif
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+	uint32_t tsval;
+	uint32_t tsecr;
+#endif
 	bool mss_found : 1;
 	bool wnd_found : 1;
+#ifdef CONFIG_NET_TCP_SACK
+	bool sack_perm_found : 1;
+#endif
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+	bool ts_found : 1;
+#endif
 };
 
+#ifdef CONFIG_NET_TCP_SACK
+
+/* Sender side SACK state, RFC 6675 */
+struct tcp_sack_scoreboard {
+	/* Ranges SACKed by the peer above the cumulative ACK, in sequence
+	 * order and not overlapping.
+	 */
+	struct tcp_sack_block blocks[NET_TCP_SACK_MAX_BLOCKS];
+	uint32_t recovery_point;
+	uint32_t high_rxt;
+	uint8_t num_blocks;
+	bool in_recovery : 1;
+};
+#endif
+
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+
+/* Round-trip time estimate, RFC 6298. All times are in milliseconds, the
+ * smoothed RTT is kept scaled by 8 and its variation scaled by 4.
+ */
+struct tcp_rtt {
+	uint32_t srtt;
+	uint32_t rttvar;
+	uint32_t rto;
+	uint32_t last;
+	uint32_t min;
+	uint32_t samples;
+};
+#endif
+
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 
 struct tcp_collision_avoidance_reno {
@@ -248,6 +309,78 @@ struct tcp_collision_avoidance_reno {
 	uint16_t ssthresh;
 	uint16_t pending_fast_retransmit_bytes;
 };
+
+/* Initial window of the algorithms other than NewReno, RFC 3390 */
+#define TCP_CA_INITIAL_WIN(_mss) MIN(4U * (_mss), MAX(2U * (_mss), 4380U))
+
+#ifdef CONFIG_NET_TCP_CONGESTION_CUBIC
+/* CUBIC state, RFC 9438. Windows are in bytes and times in milliseconds. */
+struct tcp_ca_cubic {
+	int64_t epoch_start;
+	uint32_t w_max;
+	uint32_t origin;
+	uint32_t k;
+	uint32_t w_est;
+};
+#endif
+
+#ifdef CONFIG_NET_TCP_CONGESTION_BBR
+#define TCP_BBR_BW_FILTER_LEN 8
+
+/* Path model of the simplified BBR. Rates are in bytes per second and
+ * times in milliseconds.
+ */
+struct tcp_ca_bbr {
+	uint32_t bw[TCP_BBR_BW_FILTER_LEN];
+	uint32_t btl_bw;
+	uint32_t full_bw;
+	uint32_t min_rtt;
+	int64_t min_rtt_stamp;
+	int64_t round_start;
+	int64_t probe_rtt_done;
+	uint32_t round_end_seq;
+	uint32_t round_delivered;
+	uint32_t rounds;
+	uint8_t mode;
+	uint8_t cycle_idx;
+	uint8_t full_bw_cnt;
+};
+#endif
+
+struct tcp;
+
+/* A congestion control algorithm, selected per connection by its name
+ * with the TCP_CONGESTION socket option. The callbacks are called with
+ * the connection locked.
+ */
+struct tcp_ca_ops {
+	const char *name;
+	/* Connection established, set up the initial window */
+	void (*init)(struct tcp *conn);
+	/* New data of acked_len bytes was cumulatively acknowledged */
+	void (*on_ack)(struct tcp *conn, uint32_t acked_len);
+	/* Duplicate acknowledgment received */
+	void (*on_dup_ack)(struct tcp *conn);
+	/* Loss detected, a fast retransmit is started */
+	void (*on_loss)(struct tcp *conn);
+	/* Optional, acked_len bytes were acknowledged during SACK based loss
+	 * recovery, the window is left to the recovery
+	 */
+	void (*on_delivered)(struct tcp *conn, uint32_t acked_len);
+	/* SACK based loss recovery has completed */
+	void (*on_recovery_end)(struct tcp *conn);
+	/* Retransmission timer expired */
+	void (*on_rto)(struct tcp *conn);
+	/* Optional, sending rate in bytes per second, 0 when not paced */
+	uint32_t (*pacing_rate)(struct tcp *conn);
+};
+
+#ifdef CONFIG_NET_TCP_CONGESTION_CUBIC
+extern const struct tcp_ca_ops tcp_ca_cubic;
+#endif
+#ifdef CONFIG_NET_TCP_CONGESTION_BBR
+extern const struct tcp_ca_ops tcp_ca_bbr;
+#endif
 #endif
 
 struct tcp;
@@ -323,6 +456,35 @@ struct tcp { /* TCP connection */
 #endif
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 	struct tcp_collision_avoidance_reno ca;
+	const struct tcp_ca_ops *ca_ops;
+#if defined(CONFIG_NET_TCP_CONGESTION_CUBIC) || defined(CONFIG_NET_TCP_CONGESTION_BBR)
+	union {
+#ifdef CONFIG_NET_TCP_CONGESTION_CUBIC
+		struct tcp_ca_cubic cubic;
+#endif
+#ifdef CONFIG_NET_TCP_CONGESTION_BBR
+		struct tcp_ca_bbr bbr;
+#endif
+	} ca_priv;
+#endif
+#endif
+#ifdef CONFIG_NET_TCP_PACING
+	struct k_work_delayable pacing_timer;
+	int64_t pacing_next_us;
+#endif
+#ifdef CONFIG_NET_TCP_SACK
+	struct tcp_sack_scoreboard sack;
+	/* A sequence number within each run of out-of-order data reported
+	 * in SACK blocks, the most recently received first
+	 */
+	uint32_t sack_recv_seq[NET_TCP_SACK_MAX_BLOCKS];
+	uint8_t sack_recv_num;
+#endif
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+	struct tcp_rtt rtt;
+	uint32_t ts_offset;
+	uint32_t ts_recent;
+	uint32_t ts_last_ack_sent;
 #endif
 	uint8_t send_data_retries;
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
@@ -337,6 +499,12 @@ struct tcp { /* TCP connection */
 #endif /* CONFIG_NET_TCP_KEEPALIVE */
 	bool tcp_nodelay : 1;
 	bool addr_ref_done : 1;
+#ifdef CONFIG_NET_TCP_SACK
+	bool sack_permitted : 1;
+#endif
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+	bool ts_enabled : 1;
+#endif
 };
 
 #define _flags(_fl, _op, _mask, _cond)					\
@@ -13,6 +13,8 @@ LOG_MODULE_DECLARE(net_shell);
 #include "net_shell_private.h"
 
 #if defined(CONFIG_NET_TCP) && defined(CONFIG_NET_NATIVE_TCP)
+#include "tcp_internal.h"
+
 static struct net_context *tcp_ctx;
 static const struct shell *tcp_shell;
 
@@ -389,6 +391,56 @@ static int cmd_net_tcp_close(const struct shell *sh, size_t argc, char *argv[])
 	return 0;
 }
 
+#if defined(CONFIG_NET_TCP) && defined(CONFIG_NET_NATIVE_TCP) && \
+	defined(CONFIG_NET_TCP_TIMESTAMPS)
+static void tcp_rtt_cb(struct tcp *conn, void *user_data)
+{
+	struct net_shell_user_data *data = user_data;
+	const struct shell *sh = data->sh;
+	int *count = data->user_data;
+
+	if (conn->state == TCP_LISTEN) {
+		return;
+	}
+
+	PR("%p   %5u    %5u %7u %7u %7u %7u %7u %7u  %s\n",
+	   conn,
+	   ntohs(net_sin6_ptr(&conn->context->local)->sin6_port),
+	   ntohs(net_sin6(&conn->context->remote)->sin6_port),
+	   conn->rtt.samples, conn->rtt.last, conn->rtt.min,
+	   conn->rtt.srtt >> 3, conn->rtt.rttvar >> 2, conn->rtt.rto,
+	   conn->ts_enabled ? "yes" : "no");
+
+	(*count)++;
+}
+#endif
+
+static int cmd_net_tcp_rtt(const struct shell *sh, size_t argc, char *argv[])
+{
+#if defined(CONFIG_NET_TCP) && defined(CONFIG_NET_NATIVE_TCP) && \
+	defined(CONFIG_NET_TCP_TIMESTAMPS)
+	struct net_shell_user_data user_data;
+	int count = 0;
+
+	PR("TCP        Src port Dst port Samples    Last     Min    SRTT  RTTVAR     RTO"
+	   "  Timestamps\n");
+
+	user_data.sh = sh;
+	user_data.user_data = &count;
+
+	net_tcp_foreach(tcp_rtt_cb, &user_data);
+
+	if (count == 0) {
+		PR("No TCP connections\n");
+	}
+#else
+	PR_INFO("Set %s to enable %s support.\n",
+		"CONFIG_NET_TCP_TIMESTAMPS", "TCP RTT statistics");
+#endif /* CONFIG_NET_TCP_TIMESTAMPS */
+
+	return 0;
+}
+
 static int cmd_net_tcp(const struct shell *sh, size_t argc, char *argv[])
 {
 	ARG_UNUSED(argc);
@@ -409,6 +461,10 @@ SHELL_STATIC_SUBCMD_SET_CREATE(net_cmd_tcp,
 		  cmd_net_tcp_recv),
 	SHELL_CMD(close, NULL,
 		  "'net tcp close' closes TCP connection.", cmd_net_tcp_close),
+	SHELL_CMD(rtt, NULL,
+		  "'net tcp rtt' shows the round-trip time statistics (in ms) "
+		  "of TCP connections.",
+		  cmd_net_tcp_rtt),
 	SHELL_SUBCMD_SET_END
 );
 
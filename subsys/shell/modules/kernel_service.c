@@ -300,6 +300,104 @@ static int cmd_kernel_heap(const struct shell *sh,
 }
 #endif
 
+#if defined(CONFIG_SCHED_LATENCY_STATS)
+static void shell_latency_hist_print(const struct shell *sh, const char *name,
+				     const uint32_t *hist)
+{
+	shell_print(sh, "\t%s:", name);
+
+	for (int i = 0; i < CONFIG_SCHED_LATENCY_STATS_BUCKETS; i++) {
+		uint32_t lo = (i == 0) ? 0U : BIT64(i - 1);
+
+		if (hist[i] == 0U) {
+			continue;
+		}
+
+		if (i == CONFIG_SCHED_LATENCY_STATS_BUCKETS - 1) {
+			shell_print(sh, "\t  >= %10u: %u", lo, hist[i]);
+		} else {
+			shell_print(sh, "\t  <= %10u: %u",
+				    (uint32_t)(BIT64(i) - 1U), hist[i]);
+		}
+	}
+}
+
+static void shell_latency_stats_print(const struct shell *sh,
+				      const k_thread_runtime_stats_t *stats,
+				      bool cpu)
+{
+	shell_latency_hist_print(sh, "wakeup latency (cycles)",
+				 stats->latency.wakeup);
+	shell_latency_hist_print(sh, "preemption latency (cycles)",
+				 stats->latency.preempt);
+	if (cpu) {
+		shell_latency_hist_print(sh, "run queue depth",
+					 stats->runq_depth);
+	}
+}
+
+#if defined(CONFIG_THREAD_MONITOR)
+static void shell_thread_latency_dump(const struct k_thread *cthread,
+				      void *user_data)
+{
+	struct k_thread *thread = (struct k_thread *)cthread;
+	const struct shell *sh = (const struct shell *)user_data;
+	k_thread_runtime_stats_t stats;
+	const char *tname;
+
+	if (k_thread_runtime_stats_get(thread, &stats) != 0) {
+		return;
+	}
+
+	tname = k_thread_name_get(thread);
+	shell_print(sh, "%p %-10s", thread, tname ? tname : "NA");
+	shell_latency_stats_print(sh, &stats, false);
+}
+#endif
+
+static int cmd_kernel_sched_latency(const struct shell *sh,
+				    size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	k_thread_runtime_stats_t stats;
+
+#if defined(CONFIG_OBJ_CORE_STATS_SYSTEM)
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (int i = 0; i < num_cpus; i++) {
+		if (k_obj_core_stats_query(K_OBJ_CORE(&_kernel.cpus[i]),
+					   &stats, sizeof(stats)) != 0) {
+			continue;
+		}
+
+		shell_print(sh, "CPU %d", i);
+		shell_latency_stats_print(sh, &stats, true);
+	}
+#else
+	if (k_thread_runtime_stats_all_get(&stats) != 0) {
+		return -ENOEXEC;
+	}
+
+	shell_print(sh, "All CPUs");
+	shell_latency_stats_print(sh, &stats, true);
+#endif
+
+#if defined(CONFIG_THREAD_MONITOR)
+	shell_print(sh, "Threads:");
+
+	/*
+	 * Use the unlocked version as the callback itself might call
+	 * arch_irq_unlock.
+	 */
+	k_thread_foreach_unlocked(shell_thread_latency_dump, (void *)sh);
+#endif
+
+	return 0;
+}
+#endif
+
 static int cmd_kernel_sleep(const struct shell *sh,
 			    size_t argc, char **argv)
 {
@@ -405,6 +503,10 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel,
 		      cmd_kernel_uptime, 1, 1),
 	SHELL_CMD(version, NULL, "Kernel version.", cmd_kernel_version),
 	SHELL_CMD_ARG(sleep, NULL, "ms", cmd_kernel_sleep, 2, 0),
+#if defined(CONFIG_SCHED_LATENCY_STATS)
+	SHELL_CMD(sched-latency, NULL, "Scheduling latency histograms.",
+		  cmd_kernel_sched_latency),
+#endif
 #if defined(CONFIG_LOG_RUNTIME_FILTERING)
 	SHELL_CMD_ARG(log-level, NULL, "<module name> <severity (0-4)>",
 		cmd_kernel_log_level_set, 3, 0),
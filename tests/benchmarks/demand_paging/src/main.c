@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/kernel/mm/demand_paging.h>
+
+/* Demand paging eviction benchmark.  Each round writes every page of a
+ * small hot data set, then reads the next few pages of a large
+ * read-only region which is swept through cyclically, like XIP code
+ * being executed.  The cold region alone does not fit in RAM.  The
+ * page fault rate and the latency of faulting accesses are reported,
+ * along with the kernel's own eviction and page-in timing histograms.
+ * Each round ends with a short sleep, standing in for the idle time
+ * that background eviction relies on.  Build with each CONFIG_EVICTION_*
+ * choice, and with read-ahead and background eviction, to compare.
+ */
+
+#define PAGE_SZ CONFIG_MMU_PAGE_SIZE
+#define HOT_PAGES 8
+#define COLD_PAGES 64
+#define COLD_PER_ROUND 4
+#define ROUNDS 512
+
+/* Both regions are initialized so they live in the image, and so are
+ * paged in from the backing store rather than zeroed at boot.
+ */
+static uint8_t __aligned(PAGE_SZ) hot[HOT_PAGES][PAGE_SZ] = { { 1 } };
+static const uint8_t __aligned(PAGE_SZ) cold[COLD_PAGES][PAGE_SZ] = { { 1 } };
+
+/* Upper bounds of the fault latency bins, in microseconds */
+static const uint32_t lat_bounds[] = {
+	10, 20, 50, 100, 200, 500, 1000, 2000, 5000, UINT32_MAX
+};
+static unsigned long lat_counts[ARRAY_SIZE(lat_bounds)];
+
+static unsigned long accesses;
+static unsigned long faulted;
+
+static void access_page(volatile uint8_t *p, bool write)
+{
+	struct k_mem_paging_stats_t before, after;
+	uint32_t t0, t1, us;
+	int i;
+
+	k_mem_paging_stats_get(&before);
+
+	t0 = k_cycle_get_32();
+	if (write) {
+		*p += 1U;
+	} else {
+		(void)*p;
+	}
+	t1 = k_cycle_get_32();
+
+	k_mem_paging_stats_get(&after);
+	accesses++;
+
+	if (after.pagefaults.cnt == before.pagefaults.cnt) {
+		return;
+	}
+
+	faulted++;
+	us = k_cyc_to_us_floor32(t1 - t0);
+	i = 0;
+	while (us > lat_bounds[i]) {
+		i++;
+	}
+	lat_counts[i]++;
+}
+
+static void print_histogram(const char *name,
+			    struct k_mem_paging_histogram_t *hist)
+{
+	printk("%s histogram (cycles):\n", name);
+	for (int i = 0; i < CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM_NUM_BINS; i++) {
+		printk("  <= %10lu: %lu\n", hist->bounds[i], hist->counts[i]);
+	}
+}
+
+int main(void)
+{
+	struct k_mem_paging_stats_t start, end;
+	struct k_mem_paging_histogram_t hist;
+	size_t next_cold = 0;
+	unsigned long faults;
+	int64_t ms;
+
+	printk("demand paging benchmark, eviction %s\n",
+	       IS_ENABLED(CONFIG_EVICTION_NRU) ? "nru" :
+	       IS_ENABLED(CONFIG_EVICTION_CLOCK) ? "clock" :
+	       IS_ENABLED(CONFIG_EVICTION_AGING) ? "aging" : "custom");
+
+	k_mem_paging_stats_get(&start);
+	ms = k_uptime_get();
+
+	for (int r = 0; r < ROUNDS; r++) {
+		for (int h = 0; h < HOT_PAGES; h++) {
+			access_page(&hot[h][r % PAGE_SZ], true);
+		}
+
+		for (int c = 0; c < COLD_PER_ROUND; c++) {
+			access_page((volatile uint8_t *)&cold[next_cold][0],
+				    false);
+			next_cold = (next_cold + 1) % COLD_PAGES;
+		}
+
+		k_msleep(1);
+	}
+
+	ms = k_uptime_delta(&ms);
+	k_mem_paging_stats_get(&end);
+	faults = end.pagefaults.cnt - start.pagefaults.cnt;
+
+	printk("paging faults %6lu accesses %6lu rate %4lu/1000 accesses %6lu/s\n",
+	       faults, accesses, (faults * 1000UL) / accesses,
+	       (unsigned long)((faults * 1000ULL) / MAX(ms, 1)));
+	printk("paging evicted clean %6lu dirty %6lu\n",
+	       end.eviction.clean - start.eviction.clean,
+	       end.eviction.dirty - start.eviction.dirty);
+#ifdef CONFIG_DEMAND_PAGING_ASYNC_EVICTION
+	printk("paging evicted in background %6lu\n",
+	       end.eviction.async - start.eviction.async);
+#endif
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+	printk("paging read ahead %6lu pages\n",
+	       end.read_ahead.pages - start.read_ahead.pages);
+#endif
+
+	printk("fault latency histogram (us), %lu faulting accesses:\n",
+	       faulted);
+	for (int i = 0; i < ARRAY_SIZE(lat_bounds); i++) {
+		printk("  <= %10u: %lu\n", lat_bounds[i], lat_counts[i]);
+	}
+
+	k_mem_paging_histogram_eviction_get(&hist);
+	print_histogram("eviction select", &hist);
+	k_mem_paging_histogram_backing_store_page_in_get(&hist);
+	print_histogram("backing store page-in", &hist);
+
+	printk("fin\n");
+
+	return 0;
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+/* FIFO multi-producer benchmark.  Up to one producer per spare CPU puts
+ * items into a single FIFO, and the main thread gets them all.  Items
+ * are recycled in rounds, since a queued item can't be put again
+ * before it has been taken.
+ */
+
+#define MAX_PRODUCERS (CONFIG_MP_MAX_NUM_CPUS - 1)
+#define ITEMS_PER_ROUND 1024
+#define ROUNDS 64
+#define TOTAL_ITEMS (ITEMS_PER_ROUND * ROUNDS)
+#define STACK_SIZE 1024
+
+struct item {
+	void *fifo_reserved;
+	uint16_t producer;
+	uint16_t seq;
+};
+
+static struct item items[ITEMS_PER_ROUND];
+static uint16_t next_seq[MAX_PRODUCERS];
+
+static K_FIFO_DEFINE(fifo);
+static K_SEM_DEFINE(round_start, 0, MAX_PRODUCERS);
+
+static struct k_thread producers[MAX_PRODUCERS];
+K_THREAD_STACK_ARRAY_DEFINE(producer_stacks, MAX_PRODUCERS, STACK_SIZE);
+
+static void producer(void *p1, void *p2, void *p3)
+{
+	int id = POINTER_TO_INT(p1);
+	int count = POINTER_TO_INT(p2);
+	int share = ITEMS_PER_ROUND / count;
+	uint16_t seq = 0;
+
+	ARG_UNUSED(p3);
+
+	for (int r = 0; r < ROUNDS; r++) {
+		k_sem_take(&round_start, K_FOREVER);
+
+		for (int i = id * share; i < (id + 1) * share; i++) {
+			items[i].producer = id;
+			items[i].seq = seq++;
+			k_fifo_put(&fifo, &items[i]);
+		}
+	}
+}
+
+static uint32_t run(int count)
+{
+	uint32_t received = 0;
+	uint64_t cycles = 0;
+	int share = ITEMS_PER_ROUND / count;
+
+	for (int i = 0; i < count; i++) {
+		next_seq[i] = 0;
+		k_thread_create(&producers[i], producer_stacks[i], STACK_SIZE,
+				producer, INT_TO_POINTER(i),
+				INT_TO_POINTER(count), NULL,
+				K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+	}
+
+	for (int r = 0; r < ROUNDS; r++) {
+		uint32_t t0, t1;
+
+		t0 = k_cycle_get_32();
+		k_sem_give_n(&round_start, count);
+
+		for (int i = 0; i < share * count; i++) {
+			struct item *item = k_fifo_get(&fifo, K_FOREVER);
+
+			if (item->seq != next_seq[item->producer]) {
+				printk("producer %u item %u out of order\n",
+				       item->producer, item->seq);
+				k_panic();
+			}
+			next_seq[item->producer]++;
+			received++;
+		}
+
+		t1 = k_cycle_get_32();
+		cycles += t1 - t0;
+	}
+
+	for (int i = 0; i < count; i++) {
+		k_thread_join(&producers[i], K_FOREVER);
+	}
+
+	return (uint32_t)(((uint64_t)received * sys_clock_hw_cycles_per_sec()) /
+			  MAX(cycles, 1U));
+}
+
+int main(void)
+{
+	printk("fifo multi-producer benchmark\n");
+
+	for (int count = 1; count <= MAX_PRODUCERS; count++) {
+		uint32_t rate = run(count);
+
+		printk("producers %2d items %6d %10u items/s\n",
+		       count, (ITEMS_PER_ROUND / count) * count * ROUNDS, rate);
+	}
+
+	printk("fin\n");
+
+	return 0;
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+/* Measures k_mem_slab_alloc()/k_mem_slab_free() throughput with 1..N
+ * threads running concurrently, each churning its own set of blocks
+ * from one shared slab.
+ */
+
+#define MAX_THREADS CONFIG_MP_MAX_NUM_CPUS
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define SLOTS 16
+#define BLOCK_SIZE 64
+#define NUM_BLOCKS (MAX_THREADS * SLOTS)
+#define DURATION_MS 500
+
+K_MEM_SLAB_DEFINE_STATIC(slab, BLOCK_SIZE, NUM_BLOCKS, 8);
+
+static struct k_thread threads[MAX_THREADS];
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, MAX_THREADS, STACK_SIZE);
+
+static uint32_t ops[MAX_THREADS];
+static uint32_t peak[MAX_THREADS];
+static atomic_t stop;
+
+static void churn(void *p1, void *p2, void *p3)
+{
+	int id = POINTER_TO_INT(p1);
+	uint32_t rand_state = 0x2545f491 + id;
+	void *slots[SLOTS] = { NULL };
+	uint32_t held = 0, n = 0;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	peak[id] = 0;
+
+	while (!atomic_get(&stop)) {
+		int s;
+
+		rand_state ^= rand_state << 13;
+		rand_state ^= rand_state >> 17;
+		rand_state ^= rand_state << 5;
+		s = rand_state % SLOTS;
+
+		if (slots[s] == NULL) {
+			if (k_mem_slab_alloc(&slab, &slots[s], K_NO_WAIT) != 0) {
+				printk("thread %d: allocation failed\n", id);
+				k_panic();
+			}
+			held++;
+			peak[id] = MAX(peak[id], held);
+		} else {
+			k_mem_slab_free(&slab, slots[s]);
+			slots[s] = NULL;
+			held--;
+		}
+		n++;
+	}
+
+	for (int i = 0; i < SLOTS; i++) {
+		if (slots[i] != NULL) {
+			k_mem_slab_free(&slab, slots[i]);
+		}
+	}
+
+	ops[id] = n;
+}
+
+/* Returns operations per second */
+static uint32_t run(int num_threads)
+{
+	uint64_t total = 0;
+	uint32_t max_held = 0;
+
+	atomic_set(&stop, 0);
+	(void)k_mem_slab_runtime_stats_reset_max(&slab);
+
+	for (int i = 0; i < num_threads; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE, churn,
+				INT_TO_POINTER(i), NULL, NULL,
+				K_PRIO_PREEMPT(5), 0, K_NO_WAIT);
+	}
+
+	k_msleep(DURATION_MS);
+	atomic_set(&stop, 1);
+
+	for (int i = 0; i < num_threads; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+		total += ops[i];
+		max_held += peak[i];
+	}
+
+	/* Blocks stashed per CPU must not count as used */
+	if ((k_mem_slab_num_used_get(&slab) != 0U) ||
+	    (k_mem_slab_num_free_get(&slab) != NUM_BLOCKS) ||
+	    (k_mem_slab_max_used_get(&slab) > max_held)) {
+		printk("bad slab stats: used %u free %u max used %u\n",
+		       k_mem_slab_num_used_get(&slab),
+		       k_mem_slab_num_free_get(&slab),
+		       k_mem_slab_max_used_get(&slab));
+		k_panic();
+	}
+
+	return (uint32_t)(total * MSEC_PER_SEC / DURATION_MS);
+}
+
+int main(void)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	uint32_t base = 0;
+
+	printk("mem_slab benchmark, per-CPU caches %s\n",
+	       IS_ENABLED(CONFIG_MEM_SLAB_PER_CPU_CACHE) ? "enabled" : "disabled");
+
+	for (int n = 1; n <= num_cpus; n++) {
+		uint32_t rate = run(n);
+
+		if (n == 1) {
+			base = MAX(rate, 1U);
+		}
+
+		printk("mem_slab threads %2d ops/s %8u speedup %u.%02u\n", n, rate,
+		       rate / base, (rate % base) * 100U / base);
+	}
+
+	printk("fin\n");
+
+	return 0;
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/udp.h>
+
+#include "connection.h"
+
+/* Connection demultiplexing benchmark.  UDP connections are registered
+ * directly with the connection layer and packets are fed to
+ * net_conn_input() with prebuilt headers, so that only the lookup of
+ * the matching connection is measured.
+ */
+
+#define MAX_SOCKETS CONFIG_NET_MAX_CONN
+#define ITERATIONS 20000
+#define LOCAL_PORT 10000
+#define REMOTE_PORT 20000
+
+static struct net_conn_handle *handles[MAX_SOCKETS];
+static uint32_t received[MAX_SOCKETS];
+
+static struct net_ipv4_hdr ipv4_hdr;
+static struct net_udp_hdr udp_hdr;
+
+static const struct in_addr local_addr = { { { 192, 0, 2, 2 } } };
+static const struct in_addr remote_addr = { { { 192, 0, 2, 1 } } };
+
+static uint32_t rand_state = 0x2545f491;
+
+static uint32_t rand32(void)
+{
+	rand_state ^= rand_state << 13;
+	rand_state ^= rand_state >> 17;
+	rand_state ^= rand_state << 5;
+
+	return rand_state;
+}
+
+static enum net_verdict recv_cb(struct net_conn *conn, struct net_pkt *pkt,
+				union net_ip_header *ip_hdr,
+				union net_proto_header *proto_hdr,
+				void *user_data)
+{
+	ARG_UNUSED(conn);
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(ip_hdr);
+	ARG_UNUSED(proto_hdr);
+
+	received[POINTER_TO_INT(user_data)]++;
+
+	/* The packet is reused for the next iteration */
+	return NET_OK;
+}
+
+/* Odd sockets are connected, even ones only bound to their port */
+static void open_socket(int i)
+{
+	struct sockaddr_in local = {
+		.sin_family = AF_INET,
+	};
+	struct sockaddr_in remote = {
+		.sin_family = AF_INET,
+		.sin_addr = remote_addr,
+	};
+	int ret;
+
+	ret = net_conn_register(IPPROTO_UDP, AF_INET,
+				(i & 1) ? (struct sockaddr *)&remote : NULL,
+				(struct sockaddr *)&local,
+				(i & 1) ? REMOTE_PORT + i : 0,
+				LOCAL_PORT + i, NULL, recv_cb,
+				INT_TO_POINTER(i), &handles[i]);
+	if (ret < 0) {
+		printk("cannot register socket %d (%d)\n", i, ret);
+		k_panic();
+	}
+}
+
+static uint32_t run(struct net_pkt *pkt, int num_sockets)
+{
+	union net_ip_header ip_hdr = { .ipv4 = &ipv4_hdr };
+	union net_proto_header proto_hdr = { .udp = &udp_hdr };
+	uint64_t cycles = 0;
+
+	for (int i = 0; i < ITERATIONS; i++) {
+		int s = rand32() % num_sockets;
+		uint32_t t0, t1;
+
+		udp_hdr.src_port = htons(REMOTE_PORT + s);
+		udp_hdr.dst_port = htons(LOCAL_PORT + s);
+
+		t0 = k_cycle_get_32();
+		(void)net_conn_input(pkt, &ip_hdr, IPPROTO_UDP, &proto_hdr);
+		t1 = k_cycle_get_32();
+		cycles += t1 - t0;
+
+		if (received[s] == 0U) {
+			printk("socket %d did not get its packet\n", s);
+			k_panic();
+		}
+		received[s] = 0U;
+	}
+
+	return (uint32_t)(((uint64_t)ITERATIONS * sys_clock_hw_cycles_per_sec()) /
+			  MAX(cycles, 1U));
+}
+
+int main(void)
+{
+	static const int counts[] = { 1, 8, 64, MAX_SOCKETS };
+	struct net_if *iface = net_if_get_default();
+	struct net_pkt *pkt;
+	int open = 0;
+
+	printk("connection demux benchmark, hash table %s\n",
+	       IS_ENABLED(CONFIG_NET_CONN_HASH) ? "enabled" : "disabled");
+
+	pkt = net_pkt_alloc_on_iface(iface, K_FOREVER);
+	net_pkt_set_family(pkt, AF_INET);
+
+	ipv4_hdr.vhl = 0x45;
+	ipv4_hdr.proto = IPPROTO_UDP;
+	net_ipv4_addr_copy_raw(ipv4_hdr.src, (const uint8_t *)&remote_addr);
+	net_ipv4_addr_copy_raw(ipv4_hdr.dst, (const uint8_t *)&local_addr);
+
+	for (int i = 0; i < ARRAY_SIZE(counts); i++) {
+		while (open < counts[i]) {
+			open_socket(open++);
+		}
+
+		printk("sockets %4d rx %8u pkts/s\n", open, run(pkt, open));
+	}
+
+	for (int i = 0; i < open; i++) {
+		(void)net_conn_unregister(handles[i]);
+	}
+	net_pkt_unref(pkt);
+
+	printk("fin\n");
+
+	return 0;
+}
@@ -0,0 +1,519 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/dummy.h>
+#include <zephyr/net/socket.h>
+
+#include "ipv4.h"
+#include "tcp_private.h"
+
+/* TCP congestion control benchmark.  A bulk transfer is sent over a
+ * dummy interface whose driver emulates the path and the receiver: a
+ * bottleneck of fixed rate with a drop tail buffer, a fixed round trip
+ * delay and random losses.  The emulated receiver acknowledges every
+ * segment it gets, in order or not, and the goodput of each congestion
+ * control algorithm is printed for each link.
+ */
+
+#define RUN_MS 20000
+#define PEER_PORT 4242
+#define EMU_MSS 1460
+#define EMU_QUEUE_LEN 256
+#define EMU_OOO_RANGES 8
+
+struct link_profile {
+	const char *name;
+	uint32_t rate;     /* bottleneck, bytes per second */
+	uint32_t rtt_ms;
+	uint32_t buffer;   /* bottleneck buffer, bytes */
+	uint32_t loss_ppm; /* random losses, per million segments */
+};
+
+static const struct link_profile links[] = {
+	{ "2 Mbit/s  50 ms 0.1% loss", 250000, 50, 12500, 1000 },
+	{ "2 Mbit/s 200 ms 0.5% loss", 250000, 200, 50000, 5000 },
+};
+
+static const char *const algorithms[] = { "reno", "cubic", "bbr" };
+
+static const struct in_addr my_addr = { { { 192, 0, 2, 1 } } };
+static const struct in_addr peer_addr = { { { 192, 0, 2, 2 } } };
+
+/* A segment on its way, due when its ACK reaches the sender */
+struct emu_segment {
+	int64_t ack_us;
+	uint32_t seq;
+	uint32_t tsval;
+	uint16_t len;
+	uint8_t flags;
+};
+
+static struct {
+	struct k_mutex lock;
+	struct k_work_delayable work;
+	struct net_if *iface;
+	const struct link_profile *link;
+	struct emu_segment queue[EMU_QUEUE_LEN];
+	uint32_t head;
+	uint32_t tail;
+	int64_t link_free_us;
+	struct {
+		uint32_t start;
+		uint32_t end;
+	} ooo[EMU_OOO_RANGES];
+	int ooo_cnt;
+	uint32_t irs;
+	uint32_t rcv_nxt;
+	uint32_t iss;
+	uint32_t ts_recent;
+	uint32_t losses;
+	uint16_t port;
+	bool ts;
+	bool reset;
+} emu;
+
+static uint32_t rand_state = 0x2545f491;
+
+static uint32_t rand32(void)
+{
+	rand_state ^= rand_state << 13;
+	rand_state ^= rand_state >> 17;
+	rand_state ^= rand_state << 5;
+
+	return rand_state;
+}
+
+static int64_t uptime_us(void)
+{
+	return k_ticks_to_us_floor64(k_uptime_ticks());
+}
+
+static struct net_pkt *emu_reply(uint8_t flags)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
+	uint8_t opts[16];
+	size_t opts_len = 0;
+	struct net_pkt *pkt;
+	struct tcphdr *th;
+
+	if (flags & SYN) {
+		opts[opts_len++] = NET_TCP_MSS_OPT;
+		opts[opts_len++] = NET_TCP_MSS_SIZE;
+		sys_put_be16(EMU_MSS, &opts[opts_len]);
+		opts_len += 2;
+	}
+
+	if (emu.ts) {
+		opts[opts_len++] = NET_TCP_NOP_OPT;
+		opts[opts_len++] = NET_TCP_NOP_OPT;
+		opts[opts_len++] = NET_TCP_TIMESTAMP_OPT;
+		opts[opts_len++] = NET_TCP_TIMESTAMP_SIZE;
+		sys_put_be32(k_uptime_get_32(), &opts[opts_len]);
+		sys_put_be32(emu.ts_recent, &opts[opts_len + 4]);
+		opts_len += 8;
+	}
+
+	pkt = net_pkt_alloc_with_buffer(emu.iface, sizeof(struct tcphdr) + opts_len,
+					AF_INET, IPPROTO_TCP, K_NO_WAIT);
+	if (pkt == NULL) {
+		return NULL;
+	}
+
+	if (net_ipv4_create(pkt, &peer_addr, &my_addr) < 0) {
+		goto fail;
+	}
+
+	th = (struct tcphdr *)net_pkt_get_data(pkt, &tcp_access);
+	if (th == NULL) {
+		goto fail;
+	}
+
+	memset(th, 0, sizeof(*th));
+	th->th_sport = htons(PEER_PORT);
+	th->th_dport = emu.port;
+	th->th_seq = htonl((flags & SYN) ? emu.iss : emu.iss + 1);
+	th->th_ack = htonl(emu.rcv_nxt);
+	th->th_off = 5U + opts_len / 4U;
+	th->th_flags = flags;
+	th->th_win = htons(UINT16_MAX);
+
+	if (net_pkt_set_data(pkt, &tcp_access) < 0 ||
+	    net_pkt_write(pkt, opts, opts_len) < 0) {
+		goto fail;
+	}
+
+	net_pkt_cursor_init(pkt);
+	if (net_ipv4_finalize(pkt, IPPROTO_TCP) < 0) {
+		goto fail;
+	}
+
+	return pkt;
+fail:
+	net_pkt_unref(pkt);
+	return NULL;
+}
+
+static void emu_ooo_add(uint32_t start, uint32_t end)
+{
+	for (int i = 0; i < emu.ooo_cnt; i++) {
+		if (net_tcp_seq_cmp(start, emu.ooo[i].end) <= 0 &&
+		    net_tcp_seq_cmp(end, emu.ooo[i].start) >= 0) {
+			if (net_tcp_seq_greater(emu.ooo[i].start, start)) {
+				emu.ooo[i].start = start;
+			}
+			if (net_tcp_seq_greater(end, emu.ooo[i].end)) {
+				emu.ooo[i].end = end;
+			}
+			return;
+		}
+	}
+
+	/* Data which does not fit is dropped, the sender resends it */
+	if (emu.ooo_cnt < EMU_OOO_RANGES) {
+		emu.ooo[emu.ooo_cnt].start = start;
+		emu.ooo[emu.ooo_cnt].end = end;
+		emu.ooo_cnt++;
+	}
+}
+
+/* Pull the out of order ranges the cumulative ACK has reached */
+static void emu_ooo_merge(void)
+{
+	bool merged;
+
+	do {
+		merged = false;
+		for (int i = 0; i < emu.ooo_cnt; i++) {
+			if (net_tcp_seq_greater(emu.ooo[i].start, emu.rcv_nxt)) {
+				continue;
+			}
+
+			if (net_tcp_seq_greater(emu.ooo[i].end, emu.rcv_nxt)) {
+				emu.rcv_nxt = emu.ooo[i].end;
+			}
+
+			emu.ooo[i] = emu.ooo[--emu.ooo_cnt];
+			merged = true;
+		}
+	} while (merged);
+}
+
+static struct net_pkt *emu_receive(struct emu_segment *seg)
+{
+	if (seg->flags & SYN) {
+		return emu_reply(SYN | ACK);
+	}
+
+	if (seg->seq == emu.rcv_nxt) {
+		emu.rcv_nxt += seg->len;
+		emu.ts_recent = seg->tsval;
+		emu_ooo_merge();
+	} else if (net_tcp_seq_greater(seg->seq, emu.rcv_nxt)) {
+		emu_ooo_add(seg->seq, seg->seq + seg->len);
+	}
+
+	return emu_reply(ACK);
+}
+
+static void emu_deliver(struct k_work *work)
+{
+	struct emu_segment *seg;
+	struct net_pkt *reply;
+	int64_t now_us;
+
+	ARG_UNUSED(work);
+
+	while (true) {
+		k_mutex_lock(&emu.lock, K_FOREVER);
+
+		if (emu.reset) {
+			emu.reset = false;
+			emu.head = emu.tail;
+			reply = emu_reply(RST | ACK);
+		} else if (emu.head == emu.tail) {
+			k_mutex_unlock(&emu.lock);
+			break;
+		} else {
+			seg = &emu.queue[emu.head % EMU_QUEUE_LEN];
+			now_us = uptime_us();
+			if (seg->ack_us > now_us) {
+				k_work_reschedule(&emu.work, K_USEC(seg->ack_us - now_us));
+				k_mutex_unlock(&emu.lock);
+				break;
+			}
+
+			emu.head++;
+			reply = emu_receive(seg);
+		}
+
+		k_mutex_unlock(&emu.lock);
+
+		if (reply != NULL && net_recv_data(emu.iface, reply) < 0) {
+			net_pkt_unref(reply);
+		}
+	}
+}
+
+static void emu_enqueue(int64_t ack_us, const struct tcphdr *th, uint32_t tsval,
+			size_t len)
+{
+	struct emu_segment *seg;
+
+	if (emu.tail - emu.head >= EMU_QUEUE_LEN) {
+		emu.losses++;
+		return;
+	}
+
+	seg = &emu.queue[emu.tail % EMU_QUEUE_LEN];
+	seg->ack_us = ack_us;
+	seg->seq = th_seq(th);
+	seg->tsval = tsval;
+	seg->len = len;
+	seg->flags = th_flags(th);
+
+	if (emu.tail++ == emu.head) {
+		k_work_reschedule(&emu.work,
+				  K_USEC(MAX(ack_us - uptime_us(), 0)));
+	}
+}
+
+/* Returns the TCP payload length, and the timestamp if there is one */
+static int emu_parse(struct net_pkt *pkt, struct tcphdr *th, uint32_t *tsval,
+		     bool *ts)
+{
+	size_t hdr_len = net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt);
+	uint8_t opts[40];
+	size_t opts_len;
+	size_t i = 0;
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	if (net_pkt_skip(pkt, hdr_len) < 0 ||
+	    net_pkt_read(pkt, th, sizeof(*th)) < 0) {
+		return -EINVAL;
+	}
+
+	opts_len = th->th_off * 4U - sizeof(*th);
+	if (opts_len > sizeof(opts) || net_pkt_read(pkt, opts, opts_len) < 0) {
+		return -EINVAL;
+	}
+
+	*ts = false;
+	while (i < opts_len && opts[i] != NET_TCP_END_OPT) {
+		if (opts[i] == NET_TCP_NOP_OPT) {
+			i++;
+			continue;
+		}
+
+		if (i + 1 >= opts_len || opts[i + 1] < 2) {
+			break;
+		}
+
+		if (opts[i] == NET_TCP_TIMESTAMP_OPT &&
+		    opts[i + 1] == NET_TCP_TIMESTAMP_SIZE) {
+			*tsval = sys_get_be32(&opts[i + 2]);
+			*ts = true;
+		}
+
+		i += opts[i + 1];
+	}
+
+	return net_pkt_get_len(pkt) - hdr_len - th->th_off * 4U;
+}
+
+static int emu_send(const struct device *dev, struct net_pkt *pkt)
+{
+	const struct link_profile *link = emu.link;
+	struct tcphdr th;
+	uint32_t tsval = 0;
+	int64_t now_us, start_us;
+	bool ts;
+	int len;
+
+	ARG_UNUSED(dev);
+
+	if (net_pkt_family(pkt) != AF_INET ||
+	    NET_IPV4_HDR(pkt)->proto != IPPROTO_TCP) {
+		return 0;
+	}
+
+	len = emu_parse(pkt, &th, &tsval, &ts);
+	if (len < 0 || link == NULL) {
+		return 0;
+	}
+
+	k_mutex_lock(&emu.lock, K_FOREVER);
+
+	now_us = uptime_us();
+
+	if (th_flags(&th) & SYN) {
+		emu.head = emu.tail;
+		emu.ooo_cnt = 0;
+		emu.link_free_us = now_us;
+		emu.port = th.th_sport;
+		emu.irs = th_seq(&th);
+		emu.rcv_nxt = emu.irs + 1;
+		emu.iss = rand32();
+		emu.ts = ts;
+		emu.ts_recent = tsval;
+		emu.losses = 0;
+		emu_enqueue(now_us + link->rtt_ms * USEC_PER_MSEC, &th, tsval, 0);
+	} else if (th_flags(&th) & FIN) {
+		/* The transfer is over, do not wait for the close */
+		emu.reset = true;
+		k_work_reschedule(&emu.work, K_NO_WAIT);
+	} else if (len > 0) {
+		start_us = MAX(now_us, emu.link_free_us);
+
+		if (rand32() % 1000000U < link->loss_ppm ||
+		    (start_us - now_us) * link->rate / USEC_PER_SEC > link->buffer) {
+			emu.losses++;
+		} else {
+			emu.link_free_us = start_us +
+					   (int64_t)len * USEC_PER_SEC / link->rate;
+			emu_enqueue(emu.link_free_us + link->rtt_ms * USEC_PER_MSEC,
+				    &th, tsval, len);
+		}
+	}
+
+	k_mutex_unlock(&emu.lock);
+
+	return 0;
+}
+
+static void emu_iface_init(struct net_if *iface)
+{
+	static uint8_t mac[] = { 0x00, 0x00, 0x5e, 0x00, 0x53, 0x01 };
+
+	net_if_set_link_addr(iface, mac, sizeof(mac), NET_LINK_ETHERNET);
+	net_if_set_mtu(iface, EMU_MSS + NET_IPV4TCPH_LEN);
+}
+
+static struct dummy_api emu_if_api = {
+	.iface_api.init = emu_iface_init,
+	.send = emu_send,
+};
+
+NET_DEVICE_INIT(net_tcp_ca_emu, "net_tcp_ca_emu", NULL, NULL, NULL, NULL,
+		CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &emu_if_api, DUMMY_L2,
+		NET_L2_GET_CTX_TYPE(DUMMY_L2), EMU_MSS + NET_IPV4TCPH_LEN);
+
+static int send_all(int sock, const uint8_t *buf, size_t len)
+{
+	struct zsock_pollfd pfd = { .fd = sock, .events = ZSOCK_POLLOUT };
+	int ret;
+
+	ret = zsock_send(sock, buf, len, ZSOCK_MSG_DONTWAIT);
+	if (ret < 0 && errno == EAGAIN) {
+		(void)zsock_poll(&pfd, 1, 100);
+		return 0;
+	}
+
+	return ret;
+}
+
+/* Goodput in kbit/s, -1 if the algorithm is not available */
+static int run(const struct link_profile *link, const char *algorithm)
+{
+	static uint8_t buf[EMU_MSS];
+	struct sockaddr_in peer = {
+		.sin_family = AF_INET,
+		.sin_port = htons(PEER_PORT),
+		.sin_addr = peer_addr,
+	};
+	uint32_t delivered;
+	int64_t start;
+	int sock;
+
+	emu.link = link;
+
+	sock = zsock_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (sock < 0) {
+		printk("cannot create socket (%d)\n", errno);
+		k_panic();
+	}
+
+	if (zsock_setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, algorithm,
+			     strlen(algorithm)) < 0) {
+		(void)zsock_close(sock);
+		return -1;
+	}
+
+	if (zsock_connect(sock, (struct sockaddr *)&peer, sizeof(peer)) < 0) {
+		printk("cannot connect (%d)\n", errno);
+		k_panic();
+	}
+
+	start = k_uptime_get();
+	while (k_uptime_get() - start < RUN_MS) {
+		if (send_all(sock, buf, sizeof(buf)) < 0) {
+			printk("send failed (%d)\n", errno);
+			break;
+		}
+	}
+
+	k_mutex_lock(&emu.lock, K_FOREVER);
+	delivered = emu.rcv_nxt - emu.irs - 1;
+	emu.link = NULL;
+	emu.reset = true;
+	k_work_reschedule(&emu.work, K_NO_WAIT);
+	k_mutex_unlock(&emu.lock);
+
+	(void)zsock_close(sock);
+	k_msleep(100);
+
+	return (int)((uint64_t)delivered * 8U / RUN_MS);
+}
+
+int main(void)
+{
+	struct net_if *iface;
+
+	k_mutex_init(&emu.lock);
+	k_work_init_delayable(&emu.work, emu_deliver);
+
+	iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+	emu.iface = iface;
+	if (net_if_ipv4_addr_add(iface, (struct in_addr *)&my_addr,
+				 NET_ADDR_MANUAL, 0) == NULL) {
+		printk("cannot add address\n");
+		k_panic();
+	}
+
+	printk("TCP congestion control benchmark, %d s per run\n",
+	       RUN_MS / MSEC_PER_SEC);
+
+	ARRAY_FOR_EACH(links, i) {
+		printk("link %s\n", links[i].name);
+
+		ARRAY_FOR_EACH(algorithms, j) {
+			int kbps = run(&links[i], algorithms[j]);
+
+			if (kbps < 0) {
+				printk("  %-6s not enabled\n", algorithms[j]);
+				continue;
+			}
+
+			printk("  %-6s %5d kbit/s, %u%% of the link, %u losses\n",
+			       algorithms[j], kbps,
+			       (uint32_t)((uint64_t)kbps * 1000U * 100U /
+					  (links[i].rate * 8U)),
+			       emu.losses);
+		}
+	}
+
+	printk("fin\n");
+
+	return 0;
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+/* Poll wakeup benchmark.  A cooperative consumer waits on N semaphores,
+ * either with k_poll() or with a poll set, and the main thread gives a
+ * random one of them.  The give only returns once the consumer has
+ * taken the semaphore and is waiting again, so the time spent in
+ * k_sem_give() is the full cost of one wakeup.
+ */
+
+#define MAX_EVENTS 256
+#define ITERATIONS 2000
+#define BATCH 8
+#define STACK_SIZE 1024
+
+static struct k_sem sems[MAX_EVENTS];
+static struct k_poll_event events[MAX_EVENTS];
+static struct k_poll_set set;
+
+static struct k_thread consumer;
+K_THREAD_STACK_DEFINE(consumer_stack, STACK_SIZE);
+
+static uint32_t rand_state = 0x2545f491;
+
+/* Deterministic xorshift, so both methods see the same sequence */
+static uint32_t rand32(void)
+{
+	rand_state ^= rand_state << 13;
+	rand_state ^= rand_state >> 17;
+	rand_state ^= rand_state << 5;
+
+	return rand_state;
+}
+
+static void poll_consumer(void *p1, void *p2, void *p3)
+{
+	int num_events = POINTER_TO_INT(p1);
+	int handled = 0;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (handled < ITERATIONS) {
+		(void)k_poll(events, num_events, K_FOREVER);
+
+		for (int i = 0; i < num_events; i++) {
+			if (events[i].state != K_POLL_STATE_NOT_READY) {
+				(void)k_sem_take(&sems[i], K_NO_WAIT);
+				events[i].state = K_POLL_STATE_NOT_READY;
+				handled++;
+			}
+		}
+	}
+}
+
+static void set_consumer(void *p1, void *p2, void *p3)
+{
+	struct k_poll_event *ready[BATCH];
+	int handled = 0;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (handled < ITERATIONS) {
+		int count = k_poll_set_wait(&set, ready, BATCH, K_FOREVER);
+
+		for (int i = 0; i < count; i++) {
+			(void)k_sem_take(ready[i]->sem, K_NO_WAIT);
+			handled++;
+		}
+	}
+}
+
+static uint32_t run(k_thread_entry_t entry, int num_events)
+{
+	uint64_t cycles = 0;
+
+	rand_state = 0x2545f491;
+
+	k_thread_create(&consumer, consumer_stack, STACK_SIZE, entry,
+			INT_TO_POINTER(num_events), NULL, NULL,
+			K_PRIO_COOP(1), 0, K_NO_WAIT);
+
+	/* Let the consumer start waiting */
+	k_yield();
+
+	for (int i = 0; i < ITERATIONS; i++) {
+		int s = rand32() % num_events;
+		uint32_t t0, t1;
+
+		t0 = k_cycle_get_32();
+		k_sem_give(&sems[s]);
+		t1 = k_cycle_get_32();
+		cycles += t1 - t0;
+	}
+
+	k_thread_join(&consumer, K_FOREVER);
+
+	return (uint32_t)k_cyc_to_ns_floor64(cycles / ITERATIONS);
+}
+
+int main(void)
+{
+	static const int sizes[] = { 8, 64, 256 };
+
+	printk("poll wakeup benchmark\n");
+
+	for (int i = 0; i < MAX_EVENTS; i++) {
+		k_sem_init(&sems[i], 0, 1);
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(sizes); i++) {
+		int n = sizes[i];
+		uint32_t poll_ns, set_ns;
+
+		for (int e = 0; e < n; e++) {
+			k_poll_event_init(&events[e], K_POLL_TYPE_SEM_AVAILABLE,
+					  K_POLL_MODE_NOTIFY_ONLY, &sems[e]);
+		}
+		poll_ns = run(poll_consumer, n);
+
+		k_poll_set_init(&set);
+		for (int e = 0; e < n; e++) {
+			(void)k_poll_set_add(&set, &events[e]);
+		}
+		set_ns = run(set_consumer, n);
+		for (int e = 0; e < n; e++) {
+			(void)k_poll_set_remove(&set, &events[e]);
+		}
+
+		printk("events %3d k_poll %6u ns poll set %6u ns\n",
+		       n, poll_ns, set_ns);
+	}
+
+	printk("fin\n");
+
+	return 0;
+}
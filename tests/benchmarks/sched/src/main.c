@@ -49,6 +49,11 @@ enum {
 
 uint32_t stamps[NUM_STAMP_STATES];
 
+#ifdef CONFIG_SMP
+void smp_scaling(void);
+void smp_mutex_handoff(void);
+#endif /* CONFIG_SMP */
+
 static struct k_spinlock lock;
 
 static inline int _stamp(int state)
@@ -150,6 +155,12 @@ int main(void)
 		       stamps[4] - stamps[3],
 		       whole, avg);
 	}
+
+#ifdef CONFIG_SMP
+	smp_scaling();
+	smp_mutex_handoff();
+#endif /* CONFIG_SMP */
+
 	printk("fin\n");
 	return 0;
 }
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/atomic.h>
+
+/* SMP mutex handoff test.  A holder thread repeatedly locks a mutex,
+ * keeps it for a short critical section and releases it, while a
+ * waiter thread (running concurrently on another CPU) blocks on the
+ * same mutex.  The reported latency is the time from the holder's
+ * k_mutex_unlock() until the waiter returns from k_mutex_lock(),
+ * which is where CONFIG_MUTEX_ADAPTIVE_SPIN saves the pend/wake round
+ * trip.
+ */
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define N_HANDOFFS 1000
+#define HOLD_US 5
+
+static K_MUTEX_DEFINE(mutex);
+static struct k_thread holder_thread, waiter_thread;
+static K_THREAD_STACK_DEFINE(holder_stack, STACK_SIZE);
+static K_THREAD_STACK_DEFINE(waiter_stack, STACK_SIZE);
+
+static atomic_t held;
+static volatile uint32_t released;
+static uint64_t handoff_cycles;
+
+static void holder(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (int i = 0; i < N_HANDOFFS; i++) {
+		k_mutex_lock(&mutex, K_FOREVER);
+		atomic_set(&held, 1);
+		k_busy_wait(HOLD_US);
+		released = k_cycle_get_32();
+		k_mutex_unlock(&mutex);
+
+		/* Wait for the waiter to get it before taking it again */
+		while (atomic_get(&held) != 0) {
+		}
+	}
+}
+
+static void waiter(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (int i = 0; i < N_HANDOFFS; i++) {
+		while (atomic_get(&held) == 0) {
+		}
+
+		k_mutex_lock(&mutex, K_FOREVER);
+		handoff_cycles += k_cycle_get_32() - released;
+		atomic_clear(&held);
+		k_mutex_unlock(&mutex);
+	}
+}
+
+void smp_mutex_handoff(void)
+{
+	int prio = k_thread_priority_get(k_current_get()) + 1;
+
+	handoff_cycles = 0U;
+
+	k_thread_create(&waiter_thread, waiter_stack, STACK_SIZE, waiter,
+			NULL, NULL, NULL, prio, 0, K_NO_WAIT);
+	k_thread_create(&holder_thread, holder_stack, STACK_SIZE, holder,
+			NULL, NULL, NULL, prio, 0, K_NO_WAIT);
+
+	k_thread_join(&holder_thread, K_FOREVER);
+	k_thread_join(&waiter_thread, K_FOREVER);
+
+	printk("smp mutex handoff (adaptive spin %s) avg %6u cycles\n",
+	       IS_ENABLED(CONFIG_MUTEX_ADAPTIVE_SPIN) ? "on" : "off",
+	       (uint32_t)(handoff_cycles / N_HANDOFFS));
+}
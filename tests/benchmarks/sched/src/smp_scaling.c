@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+/* SMP scaling test.  For 1..N CPUs it starts that many independent
+ * pairs of threads which ping-pong through a pair of semaphores for
+ * a fixed amount of time.  Each wakeup is a context switch on the
+ * waking side and a cross-thread (and usually cross-CPU) wakeup on
+ * the other, so the aggregate round trip rate shows how well the
+ * scheduler scales when several CPUs hit it at once, and the
+ * measured give-to-wake latency shows what that costs each wakeup.
+ */
+
+#define MAX_PAIRS CONFIG_MP_MAX_NUM_CPUS
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define RUN_MS 500
+
+struct pair {
+	struct k_sem ping;
+	struct k_sem pong;
+	uint32_t stamp;
+	uint32_t round_trips;
+	uint64_t wake_cycles;
+};
+
+static struct pair pairs[MAX_PAIRS];
+static struct k_thread threads[2 * MAX_PAIRS];
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, 2 * MAX_PAIRS, STACK_SIZE);
+
+static volatile bool running;
+
+static void pinger(void *p1, void *p2, void *p3)
+{
+	struct pair *p = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (running) {
+		p->stamp = k_cycle_get_32();
+		k_sem_give(&p->ping);
+		k_sem_take(&p->pong, K_FOREVER);
+		p->round_trips++;
+	}
+
+	/* Unblock the ponger for the last time */
+	p->stamp = k_cycle_get_32();
+	k_sem_give(&p->ping);
+}
+
+static void ponger(void *p1, void *p2, void *p3)
+{
+	struct pair *p = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_take(&p->ping, K_FOREVER);
+		p->wake_cycles += k_cycle_get_32() - p->stamp;
+		/* Answer even when stopping, the pinger may be waiting */
+		k_sem_give(&p->pong);
+		if (!running) {
+			break;
+		}
+	}
+}
+
+static void run(int npairs)
+{
+	int prio = k_thread_priority_get(k_current_get()) + 1;
+	uint64_t trips = 0U, wake = 0U;
+
+	running = true;
+
+	for (int i = 0; i < npairs; i++) {
+		struct pair *p = &pairs[i];
+
+		k_sem_init(&p->ping, 0, 1);
+		k_sem_init(&p->pong, 0, 1);
+		p->round_trips = 0U;
+		p->wake_cycles = 0U;
+
+		k_thread_create(&threads[2 * i], stacks[2 * i], STACK_SIZE,
+				ponger, p, NULL, NULL, prio, 0, K_NO_WAIT);
+		k_thread_create(&threads[2 * i + 1], stacks[2 * i + 1],
+				STACK_SIZE, pinger, p, NULL, NULL, prio, 0,
+				K_NO_WAIT);
+	}
+
+	k_msleep(RUN_MS);
+	running = false;
+
+	for (int i = 0; i < 2 * npairs; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+	}
+
+	for (int i = 0; i < npairs; i++) {
+		trips += pairs[i].round_trips;
+		wake += pairs[i].wake_cycles;
+	}
+
+	/* Every round trip is two wakeups and two context switches */
+	printk("smp pairs %d round trips/s %6u wakeup avg %6u cycles\n",
+	       npairs, (uint32_t)(trips * MSEC_PER_SEC / RUN_MS),
+	       (uint32_t)(wake / MAX(trips, 1U)));
+}
+
+void smp_scaling(void)
+{
+	for (int n = 1; n <= arch_num_cpus(); n++) {
+		run(n);
+	}
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/timing/timing.h>
+#include <ksched.h>
+#include <priority_q.h>
+
+/* Ready queue microbenchmark for the multiq backend.  It measures
+ * z_priq_mq_add(), z_priq_mq_best() and z_priq_mq_remove() on a
+ * private queue holding a single thread, placing that thread at
+ * priorities spread over the whole configured range.  A thread at the
+ * numerically highest priority is the worst case for any search that
+ * scans the bitmap.  The testcase scenarios sweep the total number of
+ * priorities (CONFIG_NUM_COOP_PRIORITIES +
+ * CONFIG_NUM_PREEMPT_PRIORITIES + 1), so the output shows whether the
+ * cost grows with it.
+ */
+
+#define N_RUNS 1000
+#define N_POINTS 8
+
+static struct _priq_mq pq;
+static struct k_thread dummy;
+
+static void run(int prio)
+{
+	uint64_t add_tot = 0U, best_tot = 0U, remove_tot = 0U;
+	struct k_thread *best;
+	timing_t start, end;
+
+	dummy.base.prio = prio;
+
+	for (int i = 0; i < N_RUNS; i++) {
+		start = timing_counter_get();
+		z_priq_mq_add(&pq, &dummy);
+		end = timing_counter_get();
+		add_tot += timing_cycles_get(&start, &end);
+
+		start = timing_counter_get();
+		best = z_priq_mq_best(&pq);
+		end = timing_counter_get();
+		best_tot += timing_cycles_get(&start, &end);
+
+		__ASSERT_NO_MSG(best == &dummy);
+		ARG_UNUSED(best);
+
+		start = timing_counter_get();
+		z_priq_mq_remove(&pq, &dummy);
+		end = timing_counter_get();
+		remove_tot += timing_cycles_get(&start, &end);
+	}
+
+	printk("prio %4d add %5u best %5u remove %5u cycles\n", prio,
+	       (uint32_t)(add_tot / N_RUNS), (uint32_t)(best_tot / N_RUNS),
+	       (uint32_t)(remove_tot / N_RUNS));
+}
+
+int main(void)
+{
+	int span = K_LOWEST_THREAD_PRIO - K_HIGHEST_THREAD_PRIO;
+
+	for (int i = 0; i < ARRAY_SIZE(pq.queues); i++) {
+		sys_dlist_init(&pq.queues[i]);
+	}
+
+	timing_init();
+	timing_start();
+
+	printk("priorities %d, bitmap words %d\n", K_NUM_THREAD_PRIO,
+	       PRIQ_BITMAP_SIZE);
+
+	for (int i = 0; i <= N_POINTS; i++) {
+		run(K_HIGHEST_THREAD_PRIO + (span * i) / N_POINTS);
+	}
+
+	timing_stop();
+
+	printk("fin\n");
+	return 0;
+}
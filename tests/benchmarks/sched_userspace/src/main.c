@@ -116,6 +116,30 @@ static int exec_test(uint8_t nb_threads)
 	return yielder_status;
 }
 
+K_SEM_DEFINE(bench_sem, 0, 1);
+
+static void exec_syscall_test(uint32_t options)
+{
+	k_tid_t tid;
+
+	tid = k_thread_create(&app_threads[0].thread, app_thread_stacks[0],
+			      APP_STACKSIZE, syscall_sem, &bench_sem, NULL, NULL,
+			      THREADS_PRIO, options, K_FOREVER);
+	k_object_access_grant(&bench_sem, tid);
+
+	stamp(MEAS_START);
+	k_thread_start(tid);
+	k_thread_join(tid, K_FOREVER);
+	stamp(MEAS_END);
+
+	uint32_t full_time = stamps[MEAS_END] - stamps[MEAS_START];
+	uint64_t time_ns = k_cyc_to_ns_near64(full_time) / NB_SYSCALLS;
+
+	printk("%s k_sem_give/take: %8" PRIu32 " cyc & %6" PRIu32 " calls -> %6"
+	       PRIu64 " ns per call\n",
+	       (options & K_USER) != 0 ? "user  " : "kernel", full_time,
+	       NB_SYSCALLS, time_ns);
+}
 
 int main(void)
 {
@@ -136,6 +160,12 @@ int main(void)
 		}
 	}
 
+	printk("============================\n");
+	printk("semaphore calls (object validation cache %s)\n",
+	       IS_ENABLED(CONFIG_OBJ_VALIDATION_CACHE) ? "on" : "off");
+	exec_syscall_test(0);
+	exec_syscall_test(K_USER);
+
 	printk("SUCCESS\n");
 	return 0;
 }
@@ -19,3 +19,14 @@ void context_switch_yield(void *p1, void *p2, void *p3)
 		k_yield();
 	}
 }
+
+void syscall_sem(void *p1, void *p2, void *p3)
+{
+	struct k_sem *sem = p1;
+	uint32_t rounds = NB_SYSCALLS / 2;
+
+	while (rounds--) {
+		k_sem_give(sem);
+		(void)k_sem_take(sem, K_NO_WAIT);
+	}
+}
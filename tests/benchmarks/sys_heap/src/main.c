@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/sys_heap.h>
+
+/* sys_heap benchmark for small allocations.  Measures the average
+ * latency of sys_heap_alloc()/sys_heap_free() over a random churn of
+ * 16 to 128 byte objects, then the fragmentation left by small
+ * short-lived objects interleaved with bigger long-lived ones.  Build
+ * with and without CONFIG_SYS_HEAP_SLABS to compare.
+ */
+
+#define HEAP_SZ (16 * 1024)
+#define SLOTS 64
+#define ITERATIONS 20000
+#define MIN_SZ 16
+#define MAX_SZ 128
+
+#define LONG_LIVED 12
+#define LONG_MIN_SZ 256
+#define LONG_MAX_SZ 512
+#define SMALL_PER_LONG 24
+
+static uint64_t heapmem[HEAP_SZ / sizeof(uint64_t)];
+static struct sys_heap heap;
+
+static void *slots[SLOTS];
+static void *small_objs[LONG_LIVED * SMALL_PER_LONG];
+static void *long_objs[LONG_LIVED];
+
+static uint32_t rand_state = 0x2545f491;
+
+/* Deterministic xorshift, so both configurations see the same sequence */
+static uint32_t rand32(void)
+{
+	rand_state ^= rand_state << 13;
+	rand_state ^= rand_state >> 17;
+	rand_state ^= rand_state << 5;
+
+	return rand_state;
+}
+
+static size_t rand_size(size_t min, size_t max)
+{
+	return min + rand32() % (max - min + 1);
+}
+
+static void latency(void)
+{
+	uint64_t alloc_cycles = 0, free_cycles = 0;
+	uint32_t allocs = 0, frees = 0;
+
+	sys_heap_init(&heap, heapmem, sizeof(heapmem));
+
+	for (int i = 0; i < ITERATIONS; i++) {
+		int s = rand32() % SLOTS;
+		uint32_t t0, t1;
+
+		if (slots[s] == NULL) {
+			size_t sz = rand_size(MIN_SZ, MAX_SZ);
+
+			t0 = k_cycle_get_32();
+			slots[s] = sys_heap_alloc(&heap, sz);
+			t1 = k_cycle_get_32();
+			alloc_cycles += t1 - t0;
+			allocs++;
+		} else {
+			t0 = k_cycle_get_32();
+			sys_heap_free(&heap, slots[s]);
+			t1 = k_cycle_get_32();
+			free_cycles += t1 - t0;
+			frees++;
+			slots[s] = NULL;
+		}
+	}
+
+	for (int s = 0; s < SLOTS; s++) {
+		sys_heap_free(&heap, slots[s]);
+		slots[s] = NULL;
+	}
+
+	printk("heap alloc avg %6u ns free avg %6u ns\n",
+	       (uint32_t)k_cyc_to_ns_floor64(alloc_cycles / MAX(allocs, 1U)),
+	       (uint32_t)k_cyc_to_ns_floor64(free_cycles / MAX(frees, 1U)));
+}
+
+/* Largest single allocation the heap can currently satisfy */
+static size_t largest_block(void)
+{
+	size_t lo = 0, hi = HEAP_SZ;
+
+	while (lo < hi) {
+		size_t mid = (lo + hi + 1) / 2;
+		void *p = sys_heap_alloc(&heap, mid);
+
+		if (p != NULL) {
+			sys_heap_free(&heap, p);
+			lo = mid;
+		} else {
+			hi = mid - 1;
+		}
+	}
+
+	return lo;
+}
+
+static void fragmentation(void)
+{
+	struct sys_memory_stats stats;
+	int n = 0;
+	size_t largest;
+
+	sys_heap_init(&heap, heapmem, sizeof(heapmem));
+
+	for (int i = 0; i < LONG_LIVED; i++) {
+		for (int j = 0; j < SMALL_PER_LONG; j++) {
+			small_objs[n++] = sys_heap_alloc(&heap,
+							 rand_size(MIN_SZ, MAX_SZ));
+		}
+		long_objs[i] = sys_heap_alloc(&heap,
+					      rand_size(LONG_MIN_SZ, LONG_MAX_SZ));
+	}
+
+	for (int i = 0; i < n; i++) {
+		sys_heap_free(&heap, small_objs[i]);
+	}
+
+	largest = largest_block();
+	sys_heap_runtime_stats_get(&heap, &stats);
+
+	printk("heap frag free %6u largest %6u (%3u%% fragmented)\n",
+	       (uint32_t)stats.free_bytes, (uint32_t)largest,
+	       (uint32_t)(100U - (100U * largest) / MAX(stats.free_bytes, 1U)));
+
+	for (int i = 0; i < LONG_LIVED; i++) {
+		sys_heap_free(&heap, long_objs[i]);
+	}
+}
+
+int main(void)
+{
+	printk("sys_heap benchmark, slab front end %s\n",
+	       IS_ENABLED(CONFIG_SYS_HEAP_SLABS) ? "enabled" : "disabled");
+
+	latency();
+	fragmentation();
+
+	printk("fin\n");
+
+	return 0;
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/timing/timing.h>
+#include <timeout_q.h>
+
+/* This is a timeout queue microbenchmark.  It measures the cost of
+ * z_add_timeout() and z_abort_timeout() with an increasing number of
+ * other timeouts already pending, which is where the timeout queue
+ * backends (CONFIG_TIMEOUT_QUEUE_*) differ.  See README.rst.
+ */
+
+#define MAX_PENDING 1000
+#define N_RUNS 1000
+
+#define MIN_TICKS CONFIG_SYS_CLOCK_TICKS_PER_SEC
+#define SPAN_TICKS (59 * CONFIG_SYS_CLOCK_TICKS_PER_SEC)
+
+static struct _timeout pending[MAX_PENDING];
+static struct _timeout probe;
+
+static const uint32_t n_pending[] = { 10, 100, 1000 };
+
+static uint32_t seed = 12345;
+
+/* Cheap LCG, we only need repeatable spread, not randomness */
+static k_timeout_t rand_timeout(void)
+{
+	seed = seed * 1103515245U + 12345U;
+
+	return K_TICKS(MIN_TICKS + ((seed >> 8) % SPAN_TICKS));
+}
+
+static void timeout_fn(struct _timeout *t)
+{
+	ARG_UNUSED(t);
+
+	printk("timeout fired during the measurement!\n");
+}
+
+static void run(uint32_t count)
+{
+	uint64_t add_tot = 0U, abort_tot = 0U;
+	timing_t start, end;
+
+	for (uint32_t i = 0; i < count; i++) {
+		z_init_timeout(&pending[i]);
+		z_add_timeout(&pending[i], timeout_fn, rand_timeout());
+	}
+
+	z_init_timeout(&probe);
+
+	for (int i = 0; i < N_RUNS; i++) {
+		k_timeout_t timeout = rand_timeout();
+
+		start = timing_counter_get();
+		z_add_timeout(&probe, timeout_fn, timeout);
+		end = timing_counter_get();
+		add_tot += timing_cycles_get(&start, &end);
+
+		start = timing_counter_get();
+		z_abort_timeout(&probe);
+		end = timing_counter_get();
+		abort_tot += timing_cycles_get(&start, &end);
+	}
+
+	for (uint32_t i = 0; i < count; i++) {
+		z_abort_timeout(&pending[i]);
+	}
+
+	printk("pending %4u add %6u abort %6u cycles (avg of %d)\n", count,
+	       (uint32_t)(add_tot / N_RUNS), (uint32_t)(abort_tot / N_RUNS),
+	       N_RUNS);
+}
+
+int main(void)
+{
+	timing_init();
+	timing_start();
+
+	printk("timeout queue: %s\n",
+	       IS_ENABLED(CONFIG_TIMEOUT_QUEUE_WHEEL) ? "wheel" : "dlist");
+
+	for (int i = 0; i < ARRAY_SIZE(n_pending); i++) {
+		run(n_pending[i]);
+	}
+
+	timing_stop();
+
+	printk("fin\n");
+	return 0;
+}
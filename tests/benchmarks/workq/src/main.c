@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+/* Work queue throughput benchmark.  A batch of independent CPU-bound
+ * work items is submitted from a single thread, and the time it takes
+ * the queue to drain is measured.  This is done first with a regular
+ * single threaded work queue, then with work-stealing queues of 1..N
+ * workers: as all items land on the worker of the submitting CPU, the
+ * others only get to run them by stealing, and throughput should scale
+ * close to linearly with the number of workers.
+ */
+
+#define MAX_WORKERS CONFIG_MP_MAX_NUM_CPUS
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define NUM_ITEMS 64
+#define ROUNDS 8
+#define WORK_US 200
+
+static struct k_work items[NUM_ITEMS];
+
+static struct k_work_q single_queue;
+static K_THREAD_STACK_DEFINE(single_stack, STACK_SIZE);
+
+/* One queue per worker count, queues[n - 1] having n workers */
+static struct k_work_q queues[MAX_WORKERS];
+static struct k_work_q_worker workers[MAX_WORKERS][MAX_WORKERS];
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, MAX_WORKERS * MAX_WORKERS,
+				   STACK_SIZE);
+
+static void work_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_busy_wait(WORK_US);
+}
+
+/* Returns items/s */
+static uint32_t run(struct k_work_q *queue)
+{
+	uint32_t start, cycles;
+
+	start = k_cycle_get_32();
+
+	for (int r = 0; r < ROUNDS; r++) {
+		for (int i = 0; i < NUM_ITEMS; i++) {
+			k_work_submit_to_queue(queue, &items[i]);
+		}
+		k_work_queue_drain(queue, false);
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	return (uint32_t)(((uint64_t)ROUNDS * NUM_ITEMS *
+			   sys_clock_hw_cycles_per_sec()) / MAX(cycles, 1U));
+}
+
+int main(void)
+{
+	/* Workers run below this thread, so that submitting a batch isn't
+	 * delayed by the worker of this CPU.
+	 */
+	int prio = k_thread_priority_get(k_current_get()) + 1;
+	unsigned int num_cpus = arch_num_cpus();
+	uint32_t base;
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		k_work_init(&items[i], work_handler);
+	}
+
+	k_work_queue_start(&single_queue, single_stack, STACK_SIZE, prio,
+			   NULL);
+	base = run(&single_queue);
+	printk("workq single thread items/s %6u\n", base);
+	base = MAX(base, 1U);
+
+	for (unsigned int n = 1; n <= num_cpus; n++) {
+		struct k_work_q *queue = &queues[n - 1];
+		uint32_t rate;
+
+		k_work_queue_start_workers(queue, workers[n - 1], n,
+					   stacks[(n - 1) * MAX_WORKERS],
+					   STACK_SIZE, prio, NULL);
+		rate = run(queue);
+
+		/* Plug the queue for good, its workers then stay idle */
+		k_work_queue_drain(queue, true);
+
+		printk("workq workers %u items/s %6u speedup %u.%02u\n", n, rate,
+		       rate / base, (rate % base) * 100U / base);
+	}
+
+	printk("fin\n");
+
+	return 0;
+}
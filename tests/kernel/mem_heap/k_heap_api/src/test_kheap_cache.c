@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include "test_kheap.h"
+
+#define CACHE_HEAP_SIZE 1024
+#define SMALL_SIZE 24
+
+K_HEAP_DEFINE(cache_heap, CACHE_HEAP_SIZE);
+
+/**
+ * @brief Test the per-CPU caches of freed k_heap blocks
+ *
+ * @ingroup kernel_kheap_api_tests
+ *
+ * @details A freed small block is handed out again by the next
+ * allocation of the same size class.  Once small blocks fill the
+ * heap and are freed, a big allocation still succeeds as the caches
+ * are drained back to the heap when it fails.
+ *
+ * @see k_heap_alloc(), k_heap_free()
+ */
+ZTEST(k_heap_api, test_k_heap_per_cpu_cache)
+{
+	void *p, *q, *list = NULL;
+	int n = 0;
+
+	if (!IS_ENABLED(CONFIG_HEAP_PER_CPU_CACHE)) {
+		ztest_test_skip();
+	}
+
+	/* Stay on one CPU so both calls use the same cache */
+	k_sched_lock();
+
+	p = k_heap_alloc(&cache_heap, SMALL_SIZE, K_NO_WAIT);
+	zassert_not_null(p, "k_heap_alloc operation failed");
+	k_heap_free(&cache_heap, p);
+
+	q = k_heap_alloc(&cache_heap, SMALL_SIZE + 4, K_NO_WAIT);
+	zassert_equal(p, q, "cached block not reused %p != %p", p, q);
+	k_heap_free(&cache_heap, q);
+
+	k_sched_unlock();
+
+	while ((p = k_heap_alloc(&cache_heap, SMALL_SIZE, K_NO_WAIT)) != NULL) {
+		*(void **)p = list;
+		list = p;
+		n++;
+	}
+	zassert_true(n > 1, "heap too small");
+
+	while (list != NULL) {
+		p = list;
+		list = *(void **)p;
+		k_heap_free(&cache_heap, p);
+	}
+
+	p = k_heap_alloc(&cache_heap, CACHE_HEAP_SIZE / 2, K_NO_WAIT);
+	zassert_not_null(p, "cached blocks were not drained");
+	k_heap_free(&cache_heap, p);
+}
@@ -25,6 +25,7 @@ K_SEM_DEFINE(sem1, 0, 1);
 static struct k_sem sem2;
 static char bad_sem[sizeof(struct k_sem)];
 static struct k_sem sem3;
+static struct k_sem sem4;
 
 static int test_object(struct k_sem *sem, int retval)
 {
@@ -183,6 +184,58 @@ ZTEST(object_validation, test_no_ref_dyn_kobj_release_mem)
 	zassert_true(ret == -EBADF, "Dynamic kernel object not released");
 }
 
+/**
+ * @brief Test that repeated validations see revocations and frees
+ *
+ * @details Validate the same objects several times, as system calls do,
+ * and check that revoking the permission, un-initializing or freeing an
+ * object is noticed by the next validation. With
+ * CONFIG_OBJ_VALIDATION_CACHE the repeated validations are cache hits.
+ *
+ * @ingroup kernel_memprotect_tests
+ *
+ * @see k_object_find_validate()
+ */
+ZTEST(object_validation, test_repeated_validation)
+{
+	struct k_object *ko;
+	struct k_sem *sem;
+
+	k_sem_init(&sem4, 0, 1);
+	k_object_access_grant(&sem4, k_current_get());
+
+	for (int i = 0; i < 3; i++) {
+		zassert_equal(k_object_find_validate(&sem4, &ko, K_OBJ_SEM,
+						     _OBJ_INIT_TRUE), 0);
+		zassert_equal(ko, k_object_find(&sem4));
+	}
+	zassert_equal(k_object_find_validate(&sem4, &ko, K_OBJ_MUTEX,
+					     _OBJ_INIT_TRUE), -EBADF);
+
+	k_object_access_revoke(&sem4, k_current_get());
+	zassert_equal(k_object_find_validate(&sem4, &ko, K_OBJ_SEM,
+					     _OBJ_INIT_TRUE), -EPERM);
+
+	k_object_access_grant(&sem4, k_current_get());
+	zassert_equal(k_object_find_validate(&sem4, &ko, K_OBJ_SEM,
+					     _OBJ_INIT_TRUE), 0);
+	k_object_uninit(&sem4);
+	zassert_equal(k_object_find_validate(&sem4, &ko, K_OBJ_SEM,
+					     _OBJ_INIT_TRUE), -EINVAL);
+
+	sem = k_object_alloc(K_OBJ_SEM);
+	zassert_not_null(sem, "Can not allocate dynamic kernel object");
+	k_sem_init(sem, 0, 1);
+	zassert_equal(k_object_find_validate(sem, &ko, K_OBJ_SEM,
+					     _OBJ_INIT_TRUE), 0);
+	zassert_equal(k_object_find_validate(sem, &ko, K_OBJ_SEM,
+					     _OBJ_INIT_TRUE), 0);
+	k_object_free(sem);
+	zassert_equal(k_object_find_validate(sem, &ko, K_OBJ_SEM,
+					     _OBJ_INIT_TRUE), -EBADF);
+	zassert_is_null(ko);
+}
+
 void *object_validation_setup(void)
 {
 	k_thread_system_pool_assign(k_current_get());
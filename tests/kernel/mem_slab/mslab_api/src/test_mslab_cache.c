@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include "test_mslab.h"
+
+#define CACHE_BLK_NUM 16
+
+K_MEM_SLAB_DEFINE_STATIC(cache_slab, BLK_SIZE, CACHE_BLK_NUM, BLK_ALIGN);
+static K_THREAD_STACK_DEFINE(cache_stack, STACKSIZE);
+static struct k_thread cache_thread;
+
+static void alloc_all(void *p1, void *p2, void *p3)
+{
+	void *block[CACHE_BLK_NUM];
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (int i = 0; i < CACHE_BLK_NUM; i++) {
+		zassert_equal(k_mem_slab_alloc(&cache_slab, &block[i], K_NO_WAIT),
+			      0, "block %d stuck in a cache", i);
+	}
+	zassert_equal(k_mem_slab_num_free_get(&cache_slab), 0);
+
+	for (int i = 0; i < CACHE_BLK_NUM; i++) {
+		k_mem_slab_free(&cache_slab, block[i]);
+	}
+}
+
+/**
+ * @brief Verify the per-CPU caches of free memory slab blocks
+ *
+ * @details A freed block is handed out again by the next allocation on
+ * the same CPU.  The used and free block counts don't include blocks
+ * stashed in the caches, and a thread running on any CPU can still
+ * allocate every block of the slab.
+ *
+ * @ingroup kernel_memory_slab_tests
+ */
+ZTEST(mslab_api, test_mslab_per_cpu_cache)
+{
+	void *block[CACHE_BLK_NUM];
+	void *p, *q;
+
+	if (!IS_ENABLED(CONFIG_MEM_SLAB_PER_CPU_CACHE)) {
+		ztest_test_skip();
+	}
+
+	/* Stay on one CPU so both calls use the same cache */
+	k_sched_lock();
+
+	zassert_equal(k_mem_slab_alloc(&cache_slab, &p, K_NO_WAIT), 0);
+	k_mem_slab_free(&cache_slab, p);
+	zassert_equal(k_mem_slab_alloc(&cache_slab, &q, K_NO_WAIT), 0);
+	zassert_equal(p, q, "cached block not reused %p != %p", p, q);
+	k_mem_slab_free(&cache_slab, q);
+
+	k_sched_unlock();
+
+	for (int i = 0; i < CACHE_BLK_NUM; i++) {
+		zassert_equal(k_mem_slab_alloc(&cache_slab, &block[i], K_NO_WAIT),
+			      0);
+		zassert_equal(k_mem_slab_num_used_get(&cache_slab), i + 1);
+	}
+	zassert_equal(k_mem_slab_alloc(&cache_slab, &p, K_NO_WAIT), -ENOMEM);
+
+	for (int i = 0; i < CACHE_BLK_NUM; i++) {
+		k_mem_slab_free(&cache_slab, block[i]);
+	}
+	zassert_equal(k_mem_slab_num_used_get(&cache_slab), 0);
+	zassert_equal(k_mem_slab_num_free_get(&cache_slab), CACHE_BLK_NUM);
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	zassert_equal(k_mem_slab_max_used_get(&cache_slab), CACHE_BLK_NUM);
+#endif
+
+	k_thread_create(&cache_thread, cache_stack, STACKSIZE, alloc_all,
+			NULL, NULL, NULL, K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+	k_thread_join(&cache_thread, K_FOREVER);
+
+	zassert_equal(k_mem_slab_num_used_get(&cache_slab), 0);
+}
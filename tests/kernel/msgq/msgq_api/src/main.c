@@ -28,12 +28,14 @@ extern struct k_msgq msgq;
 extern struct k_sem end_sema;
 extern struct k_thread tdata;
 K_THREAD_STACK_DECLARE(tstack, STACK_SIZE);
+extern void msgq_zero_copy_setup(void);
 
 void *msgq_api_setup(void)
 {
 	k_thread_access_grant(k_current_get(), &kmsgq, &msgq, &end_sema,
 			      &tdata, &tstack);
 	k_thread_heap_assign(k_current_get(), &test_pool);
+	msgq_zero_copy_setup();
 	return NULL;
 }
 ZTEST_SUITE(msgq_api, NULL, msgq_api_setup, NULL, NULL, NULL);
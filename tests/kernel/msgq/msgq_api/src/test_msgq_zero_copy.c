@@ -0,0 +1,351 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_msgq.h"
+
+K_THREAD_STACK_DECLARE(tstack, STACK_SIZE);
+extern struct k_thread tdata;
+
+K_MSGQ_DEFINE(zc_msgq, MSG_SIZE, MSGQ_LEN, 4);
+
+static ZTEST_BMEM char __aligned(4) zc_user_buf[MSG_SIZE * MSGQ_LEN];
+struct k_msgq zc_user_msgq;
+
+void msgq_zero_copy_setup(void)
+{
+	k_msgq_init(&zc_user_msgq, zc_user_buf, MSG_SIZE, MSGQ_LEN);
+	k_thread_access_grant(k_current_get(), &zc_user_msgq);
+}
+
+static void put_msg(uint32_t msg)
+{
+	void *slot;
+
+	zassert_equal(k_msgq_alloc_put(&zc_msgq, &slot, K_NO_WAIT), 0);
+	*(uint32_t *)slot = msg;
+	zassert_equal(k_msgq_commit(&zc_msgq), 0);
+}
+
+static uint32_t get_msg(void)
+{
+	void *slot;
+	uint32_t msg;
+
+	zassert_equal(k_msgq_peek_get(&zc_msgq, &slot, K_NO_WAIT), 0);
+	msg = *(uint32_t *)slot;
+	zassert_equal(k_msgq_release(&zc_msgq), 0);
+
+	return msg;
+}
+
+static void tThread_peek_get(void *p1, void *p2, void *p3)
+{
+	void *slot;
+
+	zassert_equal(k_msgq_peek_get(&zc_msgq, &slot, K_FOREVER), 0);
+	zassert_equal(*(uint32_t *)slot, MSG0);
+	zassert_equal(k_msgq_release(&zc_msgq), 0);
+}
+
+static void tThread_alloc_put(void *p1, void *p2, void *p3)
+{
+	void *slot;
+
+	zassert_equal(k_msgq_alloc_put(&zc_msgq, &slot, K_FOREVER), 0);
+	*(uint32_t *)slot = MSG1;
+	zassert_equal(k_msgq_commit(&zc_msgq), 0);
+}
+
+static void tThread_put(void *p1, void *p2, void *p3)
+{
+	uint32_t msg = MSG1;
+
+	zassert_equal(k_msgq_put(&zc_msgq, &msg, K_FOREVER), 0);
+}
+
+static void tThread_get(void *p1, void *p2, void *p3)
+{
+	uint32_t msg;
+
+	zassert_equal(k_msgq_get(&zc_msgq, &msg, K_FOREVER), 0);
+	zassert_equal(msg, MSG1);
+}
+
+/**
+ * @addtogroup kernel_message_queue_tests
+ * @{
+ */
+
+/**
+ * @brief Test zero-copy messages interoperating with copied ones
+ * @see k_msgq_alloc_put(), k_msgq_commit(), k_msgq_peek_get(),
+ * k_msgq_release()
+ */
+ZTEST(msgq_api, test_msgq_zero_copy)
+{
+	uint32_t msg;
+
+	k_msgq_purge(&zc_msgq);
+
+	put_msg(MSG0);
+	zassert_equal(k_msgq_get(&zc_msgq, &msg, K_NO_WAIT), 0);
+	zassert_equal(msg, MSG0);
+
+	msg = MSG1;
+	zassert_equal(k_msgq_put(&zc_msgq, &msg, K_NO_WAIT), 0);
+	zassert_equal(get_msg(), MSG1);
+
+	/* messages keep their order across the ring wrap-around */
+	for (uint32_t i = 0; i < 2 * MSGQ_LEN; i++) {
+		put_msg(i);
+		zassert_equal(get_msg(), i);
+	}
+	zassert_equal(k_msgq_num_used_get(&zc_msgq), 0);
+}
+
+/**
+ * @brief Test that a reserved or held slot excludes other operations
+ * @see k_msgq_alloc_put(), k_msgq_commit(), k_msgq_peek_get(),
+ * k_msgq_release()
+ */
+ZTEST(msgq_api, test_msgq_zero_copy_busy)
+{
+	void *slot, *other;
+	uint32_t msg;
+
+	k_msgq_purge(&zc_msgq);
+
+	zassert_equal(k_msgq_commit(&zc_msgq), -EINVAL);
+	zassert_equal(k_msgq_release(&zc_msgq), -EINVAL);
+	zassert_equal(k_msgq_peek_get(&zc_msgq, &slot, K_NO_WAIT), -ENOMSG);
+
+	zassert_equal(k_msgq_alloc_put(&zc_msgq, &slot, K_NO_WAIT), 0);
+	zassert_equal(k_msgq_alloc_put(&zc_msgq, &other, K_NO_WAIT), -EBUSY);
+
+	/* the reserved slot counts against capacity, a put fills the next */
+	msg = MSG1;
+	zassert_equal(k_msgq_put(&zc_msgq, &msg, K_NO_WAIT), 0);
+	zassert_equal(k_msgq_num_free_get(&zc_msgq), 0);
+	zassert_equal(k_msgq_put(&zc_msgq, &msg, K_NO_WAIT), -ENOMSG);
+
+	/* the put message is received after the reserved one */
+	zassert_equal(k_msgq_get(&zc_msgq, &msg, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_peek(&zc_msgq, &msg), -ENOMSG);
+	zassert_equal(k_msgq_peek_get(&zc_msgq, &other, K_NO_WAIT), -ENOMSG);
+	*(uint32_t *)slot = MSG0;
+	zassert_equal(k_msgq_commit(&zc_msgq), 0);
+	zassert_equal(k_msgq_commit(&zc_msgq), -EINVAL);
+	zassert_equal(k_msgq_alloc_put(&zc_msgq, &slot, K_NO_WAIT), -ENOMSG);
+
+	zassert_equal(k_msgq_peek_get(&zc_msgq, &slot, K_NO_WAIT), 0);
+	zassert_equal(k_msgq_peek_get(&zc_msgq, &other, K_NO_WAIT), -EBUSY);
+	zassert_equal(k_msgq_get(&zc_msgq, &msg, K_NO_WAIT), -ENOMSG);
+	zassert_equal(*(uint32_t *)slot, MSG0);
+	zassert_equal(k_msgq_release(&zc_msgq), 0);
+	zassert_equal(k_msgq_release(&zc_msgq), -EINVAL);
+
+	zassert_equal(get_msg(), MSG1);
+}
+
+/**
+ * @brief Test that a purge keeps the reserved slot
+ * @see k_msgq_alloc_put(), k_msgq_purge()
+ */
+ZTEST(msgq_api, test_msgq_zero_copy_purge)
+{
+	void *slot;
+	uint32_t msg = MSG1;
+
+	k_msgq_purge(&zc_msgq);
+
+	zassert_equal(k_msgq_put(&zc_msgq, &msg, K_NO_WAIT), 0);
+	zassert_equal(k_msgq_alloc_put(&zc_msgq, &slot, K_NO_WAIT), 0);
+	k_msgq_purge(&zc_msgq);
+	zassert_equal(k_msgq_num_used_get(&zc_msgq), 0);
+	zassert_equal(k_msgq_num_free_get(&zc_msgq), MSGQ_LEN - 1);
+
+	*(uint32_t *)slot = MSG0;
+	zassert_equal(k_msgq_commit(&zc_msgq), 0);
+	zassert_equal(get_msg(), MSG0);
+	zassert_equal(k_msgq_num_used_get(&zc_msgq), 0);
+}
+
+/**
+ * @brief Test blocking zero-copy consumers and producers
+ * @see k_msgq_alloc_put(), k_msgq_peek_get()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_zero_copy_pending)
+{
+	k_tid_t tid;
+
+	k_msgq_purge(&zc_msgq);
+
+	/* the consumer waits for a message and is handed the slot */
+	tid = k_thread_create(&tdata, tstack, STACK_SIZE,
+			      tThread_peek_get, NULL, NULL, NULL,
+			      K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+	put_msg(MSG0);
+	k_thread_join(tid, K_FOREVER);
+	zassert_equal(k_msgq_num_used_get(&zc_msgq), 0);
+
+	/* the producer waits for a free slot and is handed it */
+	put_msg(MSG0);
+	put_msg(MSG0);
+	tid = k_thread_create(&tdata, tstack, STACK_SIZE,
+			      tThread_alloc_put, NULL, NULL, NULL,
+			      K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+	zassert_equal(get_msg(), MSG0);
+	k_thread_join(tid, K_FOREVER);
+	zassert_equal(get_msg(), MSG0);
+	zassert_equal(get_msg(), MSG1);
+}
+
+/**
+ * @brief Test that copying producers and consumers wait for zero-copy ones
+ * @see k_msgq_put(), k_msgq_get(), k_msgq_commit(), k_msgq_release()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_zero_copy_pending_copy)
+{
+	k_tid_t tid;
+	void *slot;
+	uint32_t msg = MSG0;
+
+	k_msgq_purge(&zc_msgq);
+
+	/* the consumer waits for the reserved message, ahead of a put one */
+	zassert_equal(k_msgq_alloc_put(&zc_msgq, &slot, K_NO_WAIT), 0);
+	zassert_equal(k_msgq_put(&zc_msgq, &msg, K_NO_WAIT), 0);
+	tid = k_thread_create(&tdata, tstack, STACK_SIZE,
+			      tThread_get, NULL, NULL, NULL,
+			      K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+	zassert_equal(k_msgq_num_used_get(&zc_msgq), 1);
+	*(uint32_t *)slot = MSG1;
+	zassert_equal(k_msgq_commit(&zc_msgq), 0);
+	k_thread_join(tid, K_FOREVER);
+	zassert_equal(get_msg(), MSG0);
+
+	/* the producer waits for the slot freed by a get, the reserved one
+	 * taking the last free slot
+	 */
+	zassert_equal(k_msgq_alloc_put(&zc_msgq, &slot, K_NO_WAIT), 0);
+	zassert_equal(k_msgq_put(&zc_msgq, &msg, K_NO_WAIT), 0);
+	tid = k_thread_create(&tdata, tstack, STACK_SIZE,
+			      tThread_put, NULL, NULL, NULL,
+			      K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+	zassert_equal(k_msgq_num_used_get(&zc_msgq), 1);
+	*(uint32_t *)slot = MSG0;
+	zassert_equal(k_msgq_commit(&zc_msgq), 0);
+	zassert_equal(get_msg(), MSG0);
+	k_thread_join(tid, K_FOREVER);
+	zassert_equal(get_msg(), MSG0);
+	zassert_equal(get_msg(), MSG1);
+
+	/* the consumer waits for the held message to be released */
+	put_msg(MSG0);
+	put_msg(MSG1);
+	zassert_equal(k_msgq_peek_get(&zc_msgq, &slot, K_NO_WAIT), 0);
+	tid = k_thread_create(&tdata, tstack, STACK_SIZE,
+			      tThread_get, NULL, NULL, NULL,
+			      K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+	zassert_equal(k_msgq_num_used_get(&zc_msgq), 2);
+	zassert_equal(*(uint32_t *)slot, MSG0);
+	zassert_equal(k_msgq_release(&zc_msgq), 0);
+	k_thread_join(tid, K_FOREVER);
+	zassert_equal(k_msgq_num_used_get(&zc_msgq), 0);
+}
+
+#ifdef CONFIG_USERSPACE
+/**
+ * @brief Test zero-copy messages from a user mode thread
+ * @see k_msgq_alloc_put(), k_msgq_commit(), k_msgq_peek_get(),
+ * k_msgq_release()
+ */
+ZTEST_USER(msgq_api, test_msgq_user_zero_copy)
+{
+	void *slot;
+
+	k_msgq_purge(&zc_user_msgq);
+
+	zassert_equal(k_msgq_alloc_put(&zc_user_msgq, &slot, K_NO_WAIT), 0);
+	*(uint32_t *)slot = MSG0;
+	zassert_equal(k_msgq_commit(&zc_user_msgq), 0);
+
+	zassert_equal(k_msgq_peek_get(&zc_user_msgq, &slot, K_NO_WAIT), 0);
+	zassert_equal(*(uint32_t *)slot, MSG0);
+	zassert_equal(k_msgq_release(&zc_user_msgq), 0);
+	zassert_equal(k_msgq_num_used_get(&zc_user_msgq), 0);
+}
+#endif /* CONFIG_USERSPACE */
+
+#ifdef CONFIG_POLL
+/**
+ * @brief Test that a committed message signals poll events
+ * @see k_msgq_commit(), k_poll()
+ */
+ZTEST(msgq_api, test_msgq_zero_copy_poll)
+{
+	struct k_poll_event event = K_POLL_EVENT_INITIALIZER(
+		K_POLL_TYPE_MSGQ_DATA_AVAILABLE, K_POLL_MODE_NOTIFY_ONLY,
+		&zc_msgq);
+	void *slot;
+
+	k_msgq_purge(&zc_msgq);
+
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), -EAGAIN);
+
+	zassert_equal(k_msgq_alloc_put(&zc_msgq, &slot, K_NO_WAIT), 0);
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), -EAGAIN);
+	*(uint32_t *)slot = MSG0;
+	zassert_equal(k_msgq_commit(&zc_msgq), 0);
+
+	event.state = K_POLL_STATE_NOT_READY;
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), 0);
+	zassert_equal(event.state, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+	zassert_equal(get_msg(), MSG0);
+}
+
+/**
+ * @brief Test that messages which can't be received don't signal poll events
+ * @see k_msgq_alloc_put(), k_msgq_peek_get(), k_msgq_release(), k_poll()
+ */
+ZTEST(msgq_api, test_msgq_zero_copy_poll_blocked)
+{
+	struct k_poll_event event = K_POLL_EVENT_INITIALIZER(
+		K_POLL_TYPE_MSGQ_DATA_AVAILABLE, K_POLL_MODE_NOTIFY_ONLY,
+		&zc_msgq);
+	void *slot;
+	uint32_t msg = MSG1;
+
+	k_msgq_purge(&zc_msgq);
+
+	/* a message queued behind a reserved slot */
+	zassert_equal(k_msgq_alloc_put(&zc_msgq, &slot, K_NO_WAIT), 0);
+	zassert_equal(k_msgq_put(&zc_msgq, &msg, K_NO_WAIT), 0);
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), -EAGAIN);
+	*(uint32_t *)slot = MSG0;
+	zassert_equal(k_msgq_commit(&zc_msgq), 0);
+
+	/* a message behind a held one */
+	zassert_equal(k_msgq_peek_get(&zc_msgq, &slot, K_NO_WAIT), 0);
+	event.state = K_POLL_STATE_NOT_READY;
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), -EAGAIN);
+	zassert_equal(k_msgq_release(&zc_msgq), 0);
+
+	event.state = K_POLL_STATE_NOT_READY;
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), 0);
+	zassert_equal(event.state, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+	zassert_equal(get_msg(), MSG1);
+}
+#endif
+
+/**
+ * @}
+ */
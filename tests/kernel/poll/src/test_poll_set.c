@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+
+#define NUM_SEMS 16
+#define SIGNAL_RESULT 0x1ee7d00d
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static struct k_poll_set set;
+static struct k_sem sems[NUM_SEMS];
+static struct k_poll_event sem_events[NUM_SEMS];
+static struct k_poll_signal set_signal;
+static struct k_poll_event signal_event;
+static struct k_fifo set_fifo;
+static struct k_poll_event fifo_event;
+
+static struct k_thread set_thread;
+K_THREAD_STACK_DEFINE(set_stack, STACK_SIZE);
+
+static void set_setup(void)
+{
+	k_poll_set_init(&set);
+
+	for (int i = 0; i < NUM_SEMS; i++) {
+		k_sem_init(&sems[i], 0, K_SEM_MAX_LIMIT);
+		k_poll_event_init(&sem_events[i], K_POLL_TYPE_SEM_AVAILABLE,
+				  K_POLL_MODE_NOTIFY_ONLY, &sems[i]);
+		sem_events[i].tag = i;
+		zassert_equal(k_poll_set_add(&set, &sem_events[i]), 0);
+	}
+}
+
+static void set_teardown(void)
+{
+	for (int i = 0; i < NUM_SEMS; i++) {
+		zassert_equal(k_poll_set_remove(&set, &sem_events[i]), 0);
+	}
+}
+
+/**
+ * @brief Test poll set delivery without waiting
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_add(), k_poll_set_remove(), k_poll_set_wait()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_no_wait)
+{
+	struct k_poll_event *ready[NUM_SEMS];
+
+	set_setup();
+
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT),
+		      -EAGAIN);
+	zassert_equal(k_poll_set_add(&set, &sem_events[0]), -EBUSY);
+
+	/* only the notified event is returned */
+	k_sem_give(&sems[5]);
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT), 1);
+	zassert_equal_ptr(ready[0], &sem_events[5]);
+	zassert_equal(ready[0]->tag, 5);
+	zassert_equal(ready[0]->state, K_POLL_STATE_SEM_AVAILABLE);
+
+	/* level-triggered: returned again until the semaphore is taken */
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT), 1);
+	zassert_equal_ptr(ready[0], &sem_events[5]);
+	zassert_equal(k_sem_take(&sems[5], K_NO_WAIT), 0);
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT),
+		      -EAGAIN);
+
+	/* and notified again once re-registered */
+	k_sem_give(&sems[5]);
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT), 1);
+	zassert_equal_ptr(ready[0], &sem_events[5]);
+	zassert_equal(k_sem_take(&sems[5], K_NO_WAIT), 0);
+
+	/* a notified event whose object was consumed is not returned */
+	k_sem_give(&sems[7]);
+	zassert_equal(k_sem_take(&sems[7], K_NO_WAIT), 0);
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT),
+		      -EAGAIN);
+
+	/* removed events are neither notified nor returned */
+	zassert_equal(k_poll_set_remove(&set, &sem_events[3]), 0);
+	zassert_equal(k_poll_set_remove(&set, &sem_events[3]), -EINVAL);
+	k_sem_give(&sems[3]);
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT),
+		      -EAGAIN);
+
+	/* an event added while ready is returned right away */
+	zassert_equal(k_poll_set_add(&set, &sem_events[3]), 0);
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT), 1);
+	zassert_equal_ptr(ready[0], &sem_events[3]);
+	zassert_equal(k_sem_take(&sems[3], K_NO_WAIT), 0);
+
+	set_teardown();
+}
+
+/**
+ * @brief Test that ready events are handed out in turn
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_wait()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_partial)
+{
+	struct k_poll_event *ready[NUM_SEMS];
+	uint32_t seen = 0U;
+	int rc;
+
+	set_setup();
+
+	for (int i = 0; i < NUM_SEMS; i += 2) {
+		k_sem_give(&sems[i]);
+	}
+
+	/* two at a time, the events not handed out come first */
+	for (int i = 0; i < NUM_SEMS / 4; i++) {
+		rc = k_poll_set_wait(&set, ready, 2, K_NO_WAIT);
+		zassert_equal(rc, 2);
+		for (int j = 0; j < rc; j++) {
+			zassert_equal(ready[j]->tag % 2, 0);
+			zassert_false(seen & BIT(ready[j]->tag));
+			seen |= BIT(ready[j]->tag);
+		}
+	}
+
+	for (int i = 0; i < NUM_SEMS; i += 2) {
+		zassert_equal(k_sem_take(&sems[i], K_NO_WAIT), 0);
+	}
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT),
+		      -EAGAIN);
+
+	set_teardown();
+}
+
+static void set_raise_helper(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_sleep(K_MSEC(50));
+	k_poll_signal_raise(&set_signal, SIGNAL_RESULT);
+}
+
+static void set_cancel_helper(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_sleep(K_MSEC(50));
+	k_fifo_cancel_wait(&set_fifo);
+}
+
+/**
+ * @brief Test waiting on a poll set
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_wait(), k_poll_signal_raise(), k_fifo_cancel_wait()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_wait)
+{
+	struct k_poll_event *ready[NUM_SEMS];
+	unsigned int signaled;
+	k_tid_t tid;
+	int result;
+
+	set_setup();
+	k_poll_signal_init(&set_signal);
+	k_poll_event_init(&signal_event, K_POLL_TYPE_SIGNAL,
+			  K_POLL_MODE_NOTIFY_ONLY, &set_signal);
+	zassert_equal(k_poll_set_add(&set, &signal_event), 0);
+	k_fifo_init(&set_fifo);
+	k_poll_event_init(&fifo_event, K_POLL_TYPE_FIFO_DATA_AVAILABLE,
+			  K_POLL_MODE_NOTIFY_ONLY, &set_fifo);
+	zassert_equal(k_poll_set_add(&set, &fifo_event), 0);
+
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_MSEC(20)),
+		      -EAGAIN);
+
+	tid = k_thread_create(&set_thread, set_stack, STACK_SIZE,
+			      set_raise_helper, NULL, NULL, NULL,
+			      K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_FOREVER), 1);
+	zassert_equal_ptr(ready[0], &signal_event);
+	zassert_equal(ready[0]->state, K_POLL_STATE_SIGNALED);
+	k_poll_signal_check(&set_signal, &signaled, &result);
+	zassert_equal(signaled, 1U);
+	zassert_equal(result, SIGNAL_RESULT);
+	k_poll_signal_reset(&set_signal);
+	k_thread_join(tid, K_FOREVER);
+
+	tid = k_thread_create(&set_thread, set_stack, STACK_SIZE,
+			      set_cancel_helper, NULL, NULL, NULL,
+			      K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_FOREVER),
+		      -EINTR);
+	k_thread_join(tid, K_FOREVER);
+
+	zassert_equal(k_poll_set_remove(&set, &fifo_event), 0);
+	zassert_equal(k_poll_set_remove(&set, &signal_event), 0);
+	set_teardown();
+}
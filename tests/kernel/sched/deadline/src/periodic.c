@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define PRIO K_LOWEST_APPLICATION_THREAD_PRIO
+
+static struct k_thread threads[2];
+K_THREAD_STACK_ARRAY_DEFINE(stacks, 2, STACK_SIZE);
+
+static volatile bool stop;
+static volatile uint32_t loops[2];
+
+static uint32_t ms_cyc(uint32_t ms)
+{
+	return k_ms_to_cyc_ceil32(ms);
+}
+
+static k_tid_t create(k_thread_entry_t entry, int i)
+{
+	return k_thread_create(&threads[i], stacks[i], STACK_SIZE, entry,
+			       INT_TO_POINTER(i), NULL, NULL, PRIO, 0,
+			       K_FOREVER);
+}
+
+static void idle_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+}
+
+/* Reservations are checked and admitted against the utilization bound,
+ * which is released again when a thread exits.
+ */
+ZTEST(suite_deadline, test_period_admission)
+{
+	k_tid_t a = create(idle_entry, 0);
+	k_tid_t b = create(idle_entry, 1);
+	uint32_t period = ms_cyc(100);
+
+	zassert_equal(k_thread_period_set(a, period, 0, 0), -EINVAL);
+	zassert_equal(k_thread_period_set(a, period, period / 2, period / 4),
+		      -EINVAL);
+	zassert_equal(k_thread_period_set(a, period, period / 4, period * 2),
+		      -EINVAL);
+
+	zassert_equal(k_thread_period_set(a, period, period / 2, 0), 0);
+	zassert_equal(k_thread_period_set(b, period, period / 2, 0), -EBUSY);
+	zassert_equal(k_thread_period_set(b, period, period * 3 / 10, 0), 0);
+
+	/* the deadline counts when shorter than the period */
+	zassert_equal(k_thread_period_set(b, period, period * 3 / 10,
+					  period / 2), -EBUSY);
+
+	/* updating a reservation replaces its utilization */
+	zassert_equal(k_thread_period_set(a, period, period / 10, 0), 0);
+	zassert_equal(k_thread_period_set(b, period, period * 7 / 10, 0), 0);
+
+	k_thread_abort(a);
+	zassert_equal(k_thread_period_set(b, period, period * 8 / 10, 0), 0);
+	k_thread_abort(b);
+}
+
+static void job_entry(void *p1, void *p2, void *p3)
+{
+	int jobs = POINTER_TO_INT(p2);
+	uint32_t work_us = POINTER_TO_INT(p3);
+
+	for (int i = 0; i < jobs; i++) {
+		if (work_us != 0U) {
+			k_busy_wait(work_us);
+		}
+		zassert_equal(k_thread_period_wait(), 0);
+	}
+}
+
+/* Jobs are released once per period and completed jobs counted */
+ZTEST(suite_deadline, test_period_wait)
+{
+	struct k_thread_period_stats stats;
+	k_tid_t tid;
+	int64_t start;
+
+	zassert_equal(k_thread_period_wait(), -EINVAL);
+
+	tid = k_thread_create(&threads[0], stacks[0], STACK_SIZE, job_entry,
+			      NULL, INT_TO_POINTER(5), INT_TO_POINTER(0),
+			      PRIO, 0, K_FOREVER);
+	zassert_equal(k_thread_period_set(tid, ms_cyc(20), ms_cyc(5), 0), 0);
+	start = k_uptime_get();
+	k_thread_start(tid);
+	k_thread_join(tid, K_FOREVER);
+
+	zassert_true(k_uptime_delta(&start) >= 90, "jobs released too early");
+	k_thread_period_stats_get(tid, &stats);
+	zassert_equal(stats.jobs, 5);
+	zassert_equal(stats.misses, 0);
+	zassert_equal(stats.overruns, 0);
+}
+
+/* Jobs completing after their deadline are counted as misses */
+ZTEST(suite_deadline, test_period_miss)
+{
+	struct k_thread_period_stats stats;
+	k_tid_t tid;
+
+	tid = k_thread_create(&threads[0], stacks[0], STACK_SIZE, job_entry,
+			      NULL, INT_TO_POINTER(3), INT_TO_POINTER(15000),
+			      PRIO, 0, K_FOREVER);
+	zassert_equal(k_thread_period_set(tid, ms_cyc(40), ms_cyc(10),
+					  ms_cyc(10)), 0);
+	k_thread_start(tid);
+	k_thread_join(tid, K_FOREVER);
+
+	k_thread_period_stats_get(tid, &stats);
+	zassert_equal(stats.jobs, 3);
+	zassert_equal(stats.misses, 3);
+	zassert_true(stats.overruns > 0, "budget not enforced");
+}
+
+static void spin_entry(void *p1, void *p2, void *p3)
+{
+	int i = POINTER_TO_INT(p1);
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (!stop) {
+		loops[i]++;
+	}
+}
+
+/* A periodic thread runs ahead of a best effort one at the same
+ * priority, but only for its budget, and behind it once throttled.
+ */
+ZTEST(suite_deadline, test_period_budget)
+{
+	struct k_thread_period_stats stats;
+	k_tid_t rt, be;
+
+	stop = false;
+	loops[0] = 0U;
+	loops[1] = 0U;
+
+	rt = create(spin_entry, 0);
+	be = create(spin_entry, 1);
+	zassert_equal(k_thread_period_set(rt, ms_cyc(50), ms_cyc(10), 0), 0);
+	k_thread_start(be);
+	k_thread_start(rt);
+
+	k_msleep(5);
+	zassert_true(loops[0] > 0U, "periodic thread did not run");
+	zassert_equal(loops[1], 0U, "best effort thread ran first");
+
+	k_msleep(500);
+	stop = true;
+	k_thread_join(rt, K_FOREVER);
+	k_thread_join(be, K_FOREVER);
+
+	k_thread_period_stats_get(rt, &stats);
+	zassert_true(stats.overruns >= 5, "only %u overruns", stats.overruns);
+	zassert_true(loops[1] > loops[0], "best effort thread starved");
+}
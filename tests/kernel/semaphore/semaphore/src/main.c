@@ -873,6 +873,53 @@ ZTEST(semaphore, test_sem_multiple_threads_wait)
 	}
 }
 
+/**
+ * @brief Test giving a semaphore multiple times at once
+ * @details Wake all waiters with a single k_sem_give_n() call, and check
+ * that the surplus is added to the count, saturating at the limit.
+ * @ingroup kernel_semaphore_tests
+ * @see k_sem_give_n()
+ */
+ZTEST(semaphore, test_sem_give_n)
+{
+	k_sem_reset(&simple_sem);
+	k_sem_reset(&multiple_thread_sem);
+
+	for (int i = 0; i < TOTAL_THREADS_WAITING; i++) {
+		k_thread_create(&multiple_tid[i],
+				multiple_stack[i], STACK_SIZE,
+				sem_multiple_threads_wait_helper,
+				NULL, NULL, NULL,
+				K_PRIO_PREEMPT(1),
+				K_USER | K_INHERIT_PERMS, K_NO_WAIT);
+	}
+
+	/* giving time for the other threads to pend */
+	k_sleep(K_MSEC(500));
+
+	/* wake all the waiters and leave a surplus of 3 */
+	k_sem_give_n(&multiple_thread_sem, TOTAL_THREADS_WAITING + 3);
+
+	for (int i = 0; i < TOTAL_THREADS_WAITING; i++) {
+		expect_k_sem_take(&simple_sem, K_FOREVER, 0,
+			"Some of the threads did not get multiple_thread_sem: %d != %d");
+	}
+	for (int i = 0; i < TOTAL_THREADS_WAITING; i++) {
+		k_thread_join(&multiple_tid[i], K_FOREVER);
+	}
+
+	expect_k_sem_count_get_nomsg(&multiple_thread_sem, 3U);
+
+	/* gives beyond the limit are discarded */
+	k_sem_give_n(&multiple_thread_sem, SEM_MAX_VAL * 2);
+	expect_k_sem_count_get_nomsg(&multiple_thread_sem, SEM_MAX_VAL);
+
+	/* giving zero times is a no-op */
+	k_sem_reset(&multiple_thread_sem);
+	k_sem_give_n(&multiple_thread_sem, 0);
+	expect_k_sem_count_get_nomsg(&multiple_thread_sem, 0U);
+}
+
 /**
  * @brief Test semaphore timeout period
  * @ingroup kernel_semaphore_tests
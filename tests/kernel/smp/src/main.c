@@ -678,10 +678,12 @@ ZTEST(smp, test_get_cpu)
 #ifdef CONFIG_TRACE_SCHED_IPI
 /* global variable for testing send IPI */
 static volatile int sched_ipi_has_called;
+static volatile int sched_ipi_cpu_count[CONFIG_MP_MAX_NUM_CPUS];
 
 void z_trace_sched_ipi(void)
 {
 	sched_ipi_has_called++;
+	sched_ipi_cpu_count[arch_curr_cpu()->id]++;
 }
 #endif
 
@@ -757,6 +759,63 @@ ZTEST(smp, test_smp_ipi)
 }
 #endif
 
+/**
+ * @brief Test directed interprocessor interrupt
+ *
+ * @ingroup kernel_smp_integration_tests
+ *
+ * @details Direct a scheduler IPI at each other CPU in turn with
+ * arch_sched_directed_ipi(), and check that the targeted CPU did call
+ * z_sched_ipi(). With CONFIG_SCHED_IPI_STATS, also check that the IPI
+ * is accounted in the CPU object core stats.
+ *
+ * @see arch_sched_directed_ipi()
+ */
+#ifdef CONFIG_ARCH_HAS_DIRECTED_IPIS
+ZTEST(smp, test_smp_directed_ipi)
+{
+#ifndef CONFIG_TRACE_SCHED_IPI
+	ztest_test_skip();
+#else
+	unsigned int num_cpus = arch_num_cpus();
+	unsigned int key;
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+#ifdef CONFIG_SCHED_IPI_STATS
+		struct k_thread_runtime_stats before, after;
+
+		zassert_ok(k_obj_core_stats_query(K_OBJ_CORE(&_kernel.cpus[i]),
+						  &before, sizeof(before)));
+#endif
+
+		/* Can't target ourselves, and must not migrate meanwhile */
+		key = arch_irq_lock();
+		if (i == arch_curr_cpu()->id) {
+			arch_irq_unlock(key);
+			continue;
+		}
+
+		sched_ipi_cpu_count[i] = 0;
+		arch_sched_directed_ipi(BIT(i));
+		arch_irq_unlock(key);
+
+		k_msleep(100);
+
+		/**TESTPOINT: check if the target CPU got the IPI */
+		zassert_true(sched_ipi_cpu_count[i] != 0,
+			     "CPU %u did not receive IPI", i);
+
+#ifdef CONFIG_SCHED_IPI_STATS
+		zassert_ok(k_obj_core_stats_query(K_OBJ_CORE(&_kernel.cpus[i]),
+						  &after, sizeof(after)));
+		zassert_true(after.ipi_count > before.ipi_count,
+			     "CPU %u IPI count did not increase", i);
+#endif
+	}
+#endif /* CONFIG_TRACE_SCHED_IPI */
+}
+#endif /* CONFIG_ARCH_HAS_DIRECTED_IPIS */
+
 void k_sys_fatal_error_handler(unsigned int reason, const z_arch_esf_t *esf)
 {
 	static int trigger;
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+
+static struct k_timer slack_timers[2];
+static volatile uint32_t slack_cyc[2];
+
+static void slack_expire(struct k_timer *timer)
+{
+	slack_cyc[ARRAY_INDEX(slack_timers, timer)] = k_cycle_get_32();
+}
+
+/**
+ * @brief Test that a timer with slack expires along with a later one
+ *
+ * Starts a timer expiring after 50 ms with 20 ms of slack and one
+ * expiring after 60 ms without.  With timeout slack enabled both
+ * expire in the same timer interrupt, otherwise 10 ms apart.
+ *
+ * @ingroup kernel_timer_tests
+ *
+ * @see k_timer_start_slack(), k_timeout_slack_stats_get()
+ */
+ZTEST(timer_api, test_timer_slack)
+{
+	uint32_t start, early_us, apart_us;
+
+	if (!IS_ENABLED(CONFIG_MULTITHREADING)) {
+		/* k_timer_status_sync() needs to block */
+		return;
+	}
+
+#ifdef CONFIG_TIMEOUT_SLACK
+	struct k_timeout_slack_stats before, after;
+
+	k_timeout_slack_stats_get(&before);
+#endif
+
+	k_timer_init(&slack_timers[0], slack_expire, NULL);
+	k_timer_init(&slack_timers[1], slack_expire, NULL);
+
+	k_usleep(1); /* align to tick */
+	start = k_cycle_get_32();
+	k_timer_start_slack(&slack_timers[0], K_MSEC(50), K_NO_WAIT,
+			    K_MSEC(20));
+	k_timer_start(&slack_timers[1], K_MSEC(60), K_NO_WAIT);
+
+	zassert_equal(k_timer_status_sync(&slack_timers[1]), 1);
+	zassert_equal(k_timer_status_get(&slack_timers[0]), 1);
+
+	/* never earlier than requested */
+	early_us = k_cyc_to_us_floor32(slack_cyc[0] - start);
+	zassert_true(early_us >= 50 * USEC_PER_MSEC - k_ticks_to_us_ceil32(1),
+		     "expired after %u us", early_us);
+
+	apart_us = k_cyc_to_us_floor32(slack_cyc[1] - slack_cyc[0]);
+#ifdef CONFIG_TIMEOUT_SLACK
+	k_timeout_slack_stats_get(&after);
+	zassert_true(apart_us < 5 * USEC_PER_MSEC,
+		     "expired %u us apart", apart_us);
+	zassert_true(after.merged > before.merged, "no wakeup merged");
+#else
+	zassert_true(apart_us >= 5 * USEC_PER_MSEC,
+		     "expired %u us apart", apart_us);
+#endif
+}
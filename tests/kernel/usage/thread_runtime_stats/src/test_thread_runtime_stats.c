@@ -541,5 +541,91 @@ ZTEST(usage_api, test_thread_stats_usage)
 	k_thread_abort(tid);
 }
 
+#ifdef CONFIG_SCHED_LATENCY_STATS
+#define LATENCY_WAKEUPS 10
+
+static K_SEM_DEFINE(latency_sem, 0, LATENCY_WAKEUPS);
+
+static void latency_helper(void *p1, void *p2, void *p3)
+{
+	for (int i = 0; i < LATENCY_WAKEUPS; i++) {
+		k_sem_take(&latency_sem, K_FOREVER);
+	}
+}
+
+static uint32_t hist_sum(const uint32_t *hist)
+{
+	uint32_t sum = 0;
+
+	for (int i = 0; i < CONFIG_SCHED_LATENCY_STATS_BUCKETS; i++) {
+		sum += hist[i];
+	}
+
+	return sum;
+}
+
+/**
+ * @brief Test the scheduling latency histograms
+ *
+ * 1. Create a higher priority helper which waits on a semaphore,
+ *    and give it repeatedly.
+ *    - Each wakeup is counted in the helper's wakeup histogram
+ * 2. Create a lower priority busy helper, and sleep twice.
+ *    - The helper is preempted by the wakeup of the main thread
+ *      and its preemption histogram counts its return
+ * 3. Get the system stats
+ *    - The CPU histograms cover the helpers and the run queue
+ *      depth is sampled
+ */
+ZTEST(usage_api, test_sched_latency_stats)
+{
+	int priority = k_thread_priority_get(k_current_get());
+	k_thread_runtime_stats_t stats;
+	k_thread_runtime_stats_t all1;
+	k_thread_runtime_stats_t all2;
+	k_tid_t tid;
+
+	k_thread_runtime_stats_all_get(&all1);
+
+	tid = k_thread_create(&helper_thread, helper_stack,
+			      K_THREAD_STACK_SIZEOF(helper_stack),
+			      latency_helper, NULL, NULL, NULL,
+			      priority - 1, 0, K_NO_WAIT);
+
+	for (int i = 0; i < LATENCY_WAKEUPS; i++) {
+		k_sem_give(&latency_sem);
+	}
+	k_thread_join(tid, K_FOREVER);
+
+	k_thread_runtime_stats_get(tid, &stats);
+
+	/* The thread start also counts as a wakeup */
+	zassert_true(hist_sum(stats.latency.wakeup) >= LATENCY_WAKEUPS);
+	zassert_true(hist_sum(stats.latency.wakeup) <= LATENCY_WAKEUPS + 1);
+	zassert_equal(hist_sum(stats.runq_depth), 0);
+
+	tid = k_thread_create(&helper_thread, helper_stack,
+			      K_THREAD_STACK_SIZEOF(helper_stack),
+			      helper1, NULL, NULL, NULL,
+			      priority + 1, 0, K_NO_WAIT);
+
+	k_sleep(K_TICKS(2));
+	k_sleep(K_TICKS(2));
+
+	k_thread_runtime_stats_get(tid, &stats);
+	zassert_true(hist_sum(stats.latency.preempt) >= 1);
+
+	k_thread_abort(tid);
+
+	k_thread_runtime_stats_all_get(&all2);
+
+	zassert_true(hist_sum(all2.latency.wakeup) >=
+		     hist_sum(all1.latency.wakeup) + LATENCY_WAKEUPS);
+	zassert_true(hist_sum(all2.latency.preempt) >
+		     hist_sum(all1.latency.preempt));
+	zassert_true(hist_sum(all2.runq_depth) > hist_sum(all1.runq_depth));
+}
+#endif
+
 ZTEST_SUITE(usage_api, NULL, NULL,
 		ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/atomic.h>
+
+#define STEAL_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define STEAL_WORKERS CONFIG_MP_MAX_NUM_CPUS
+#define STEAL_PRIORITY K_PRIO_PREEMPT(0)
+#define STEAL_RESUBMITS 50
+
+static struct k_work_q steal_queue;
+static struct k_work_q_worker steal_workers[STEAL_WORKERS];
+static K_THREAD_STACK_ARRAY_DEFINE(steal_stacks, STEAL_WORKERS,
+				   STEAL_STACK_SIZE);
+
+static struct k_work steal_work[STEAL_WORKERS + 1];
+static struct k_work_sync steal_sync;
+
+static atomic_t steal_running;
+static atomic_t steal_count;
+static atomic_t steal_timeouts;
+static volatile bool steal_done;
+
+/* Stays busy until all workers run an item at the same time, or
+ * long enough for that to be a failure.
+ */
+static void barrier_handler(struct k_work *work)
+{
+	int64_t end = k_uptime_get() + 1000;
+
+	ARG_UNUSED(work);
+
+	atomic_inc(&steal_count);
+	while (atomic_get(&steal_count) < arch_num_cpus()) {
+		if (k_uptime_get() > end) {
+			atomic_inc(&steal_timeouts);
+			break;
+		}
+	}
+}
+
+/* Checks it's never re-entered while resubmitting itself. */
+static void reentrant_handler(struct k_work *work)
+{
+	zassert_equal(atomic_inc(&steal_running), 0, "handler re-entered");
+
+	k_busy_wait(100);
+	if (atomic_inc(&steal_count) < STEAL_RESUBMITS) {
+		zassert_true(k_work_submit_to_queue(&steal_queue, work) >= 0);
+	}
+	k_busy_wait(100);
+
+	atomic_dec(&steal_running);
+}
+
+static void slow_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_msleep(50);
+	steal_done = true;
+}
+
+/* Independent items submitted from one CPU get spread over all workers */
+ZTEST(work_stealing, test_stealing_parallel)
+{
+	atomic_set(&steal_count, 0);
+	atomic_set(&steal_timeouts, 0);
+
+	for (int i = 0; i < arch_num_cpus(); i++) {
+		k_work_init(&steal_work[i], barrier_handler);
+		zassert_equal(k_work_submit_to_queue(&steal_queue,
+						     &steal_work[i]), 1);
+	}
+
+	zassert_ok(k_work_queue_drain(&steal_queue, false));
+	zassert_equal(atomic_get(&steal_timeouts), 0,
+		      "items did not all run in parallel");
+}
+
+/* A handler resubmitting itself never runs on two workers at once */
+ZTEST(work_stealing, test_stealing_no_reentrancy)
+{
+	atomic_set(&steal_running, 0);
+	atomic_set(&steal_count, 0);
+
+	k_work_init(&steal_work[0], reentrant_handler);
+	zassert_equal(k_work_submit_to_queue(&steal_queue, &steal_work[0]), 1);
+
+	zassert_ok(k_work_queue_drain(&steal_queue, false));
+	zassert_equal(atomic_get(&steal_count), STEAL_RESUBMITS + 1);
+}
+
+/* Flushing waits for the item, whichever worker runs it */
+ZTEST(work_stealing, test_stealing_flush)
+{
+	for (int i = 0; i < arch_num_cpus(); i++) {
+		steal_done = false;
+		k_work_init(&steal_work[i], slow_handler);
+		zassert_equal(k_work_submit_to_queue(&steal_queue,
+						     &steal_work[i]), 1);
+
+		zassert_true(k_work_flush(&steal_work[i], &steal_sync));
+		zassert_true(steal_done);
+		zassert_equal(k_work_busy_get(&steal_work[i]), 0);
+	}
+}
+
+/* Cancelling waits for running items and removes queued ones */
+ZTEST(work_stealing, test_stealing_cancel)
+{
+	int num = arch_num_cpus();
+
+	for (int i = 0; i <= num; i++) {
+		k_work_init(&steal_work[i], slow_handler);
+	}
+
+	/* Keep all workers busy, so that the last item stays queued */
+	for (int i = 0; i <= num; i++) {
+		zassert_equal(k_work_submit_to_queue(&steal_queue,
+						     &steal_work[i]), 1);
+	}
+	k_msleep(10);
+
+	zassert_equal(k_work_cancel(&steal_work[num]), 0);
+	zassert_true(k_work_cancel_sync(&steal_work[0], &steal_sync));
+	zassert_equal(k_work_busy_get(&steal_work[0]), 0);
+
+	zassert_ok(k_work_queue_drain(&steal_queue, false));
+	zassert_equal(k_work_busy_get(&steal_work[num]), 0);
+}
+
+static void *stealing_setup(void)
+{
+	k_work_queue_init(&steal_queue);
+	k_work_queue_start_workers(&steal_queue, steal_workers,
+				   arch_num_cpus(), steal_stacks[0],
+				   STEAL_STACK_SIZE, STEAL_PRIORITY, NULL);
+
+	return NULL;
+}
+
+ZTEST_SUITE(work_stealing, NULL, stealing_setup, NULL, NULL, NULL);
@@ -544,6 +544,45 @@ static void test_route_preference(void)
 	net_route_del(route_entry);
 }
 
+static void test_route_longest_prefix(void)
+{
+	struct in6_addr prefix = { { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+				       0, 0, 0, 0, 0, 0, 0, 0 } } };
+	struct net_route_entry *host_route, *prefix_route, *entry;
+
+	host_route = net_route_add(my_iface,
+				   &dest_addr, 128,
+				   &peer_addr_alt,
+				   NET_IPV6_ND_INFINITE_LIFETIME,
+				   NET_ROUTE_PREFERENCE_LOW);
+	zassert_not_null(host_route, "Host route add failed");
+
+	prefix_route = net_route_add(my_iface,
+				     &prefix, 64,
+				     &peer_addr,
+				     NET_IPV6_ND_INFINITE_LIFETIME,
+				     NET_ROUTE_PREFERENCE_LOW);
+	zassert_not_null(prefix_route, "Prefix route add failed");
+
+	entry = net_route_lookup(my_iface, &dest_addr);
+	zassert_equal_ptr(entry, host_route, "Host route not preferred");
+
+	entry = net_route_lookup(NULL, &generic_addr);
+	zassert_equal_ptr(entry, prefix_route, "Prefix route not found");
+
+	entry = net_route_lookup(my_iface, &ll_addr);
+	zassert_is_null(entry, "Route found for unrouted address");
+
+	zassert_false(net_route_del(host_route), "Host route del failed");
+
+	entry = net_route_lookup(my_iface, &dest_addr);
+	zassert_equal_ptr(entry, prefix_route, "Prefix route not used");
+
+	zassert_false(net_route_del(prefix_route), "Prefix route del failed");
+
+	entry = net_route_lookup(my_iface, &dest_addr);
+	zassert_is_null(entry, "Deleted route still found");
+}
 
 /*test case main entry*/
 ZTEST(route_test_suite, test_route)
@@ -566,6 +605,7 @@ ZTEST(route_test_suite, test_route)
 	test_route_del_many();
 	test_route_lifetime();
 	test_route_preference();
+	test_route_longest_prefix();
 }
 
 ZTEST_SUITE(route_test_suite, NULL, NULL, NULL, NULL, NULL);
@@ -2415,6 +2415,65 @@ ZTEST(net_socket_tcp, test_so_keepalive)
 	test_context_cleanup();
 }
 
+static void check_tcp_congestion(int sock, const char *expected)
+{
+	char name[16];
+	socklen_t optlen = sizeof(name);
+	int ret;
+
+	ret = zsock_getsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, name, &optlen);
+	zassert_equal(ret, 0, "getsockopt failed (%d)", errno);
+	zassert_equal(optlen, strlen(expected) + 1, "getsockopt got invalid size");
+	zassert_equal(strcmp(name, expected), 0, "getsockopt got invalid value");
+}
+
+ZTEST(net_socket_tcp, test_tcp_congestion)
+{
+	struct sockaddr_in bind_addr4;
+	int sock, ret;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_TCP_CONGESTION_AVOIDANCE);
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &sock, &bind_addr4);
+
+	if (IS_ENABLED(CONFIG_NET_TCP_CONGESTION_DEFAULT_CUBIC)) {
+		check_tcp_congestion(sock, "cubic");
+	} else if (IS_ENABLED(CONFIG_NET_TCP_CONGESTION_DEFAULT_BBR)) {
+		check_tcp_congestion(sock, "bbr");
+	} else {
+		check_tcp_congestion(sock, "reno");
+	}
+
+	ret = zsock_setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, "vegas",
+			       strlen("vegas"));
+	zassert_equal(ret, -1, "setsockopt should have failed");
+	zassert_equal(errno, ENOENT, "setsockopt got invalid errno");
+
+	/* The name does not need to be NUL terminated */
+	ret = zsock_setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, "reno",
+			       strlen("reno"));
+	zassert_equal(ret, 0, "setsockopt failed (%d)", errno);
+	check_tcp_congestion(sock, "reno");
+
+	if (IS_ENABLED(CONFIG_NET_TCP_CONGESTION_CUBIC)) {
+		ret = zsock_setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION,
+				       "cubic", sizeof("cubic"));
+		zassert_equal(ret, 0, "setsockopt failed (%d)", errno);
+		check_tcp_congestion(sock, "cubic");
+	}
+
+	if (IS_ENABLED(CONFIG_NET_TCP_CONGESTION_BBR)) {
+		ret = zsock_setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION,
+				       "bbr", sizeof("bbr"));
+		zassert_equal(ret, 0, "setsockopt failed (%d)", errno);
+		check_tcp_congestion(sock, "bbr");
+	}
+
+	test_close(sock);
+
+	test_context_cleanup();
+}
+
 ZTEST(net_socket_tcp, test_keepalive_timeout)
 {
 	struct sockaddr_in c_saddr, s_saddr;
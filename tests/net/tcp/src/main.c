@@ -112,6 +112,7 @@ enum test_state {
 	T_FIN_2,
 	T_CLOSING,
 	T_RST,
+	T_SACK,
 };
 
 static enum test_case_no {
@@ -133,6 +134,8 @@ static enum test_case_no {
 	TEST_CLIENT_CLOSING_FAILURE_IPV6 = 16,
 	TEST_CLIENT_FIN_WAIT_2_IPV4_FAILURE = 17,
 	TEST_CLIENT_FIN_ACK_WITH_DATA = 18,
+	TEST_CLIENT_SACK_IPV4 = 19,
+	TEST_CLIENT_TIMESTAMPS_IPV4 = 20,
 } test_case_no;
 
 static enum test_state t_state;
@@ -157,6 +160,8 @@ static void handle_server_rst_on_closed_port(sa_family_t af, struct tcphdr *th);
 static void handle_server_rst_on_listening_port(sa_family_t af, struct tcphdr *th);
 static void handle_syn_invalid_ack(sa_family_t af, struct tcphdr *th);
 static void handle_client_fin_ack_with_data_test(sa_family_t af, struct tcphdr *th);
+static void handle_client_sack_test(struct net_pkt *pkt, struct tcphdr *th);
+static void handle_client_timestamps_test(struct net_pkt *pkt, struct tcphdr *th);
 
 static void verify_flags(struct tcphdr *th, uint8_t flags,
 			 const char *fun, int line)
@@ -254,6 +259,10 @@ static uint8_t tcp_options[20] = {
 	0x01, /* NOP */
 	0x03, 0x03, 0x07 /* Win scale*/ };
 
+/* Options added to the packets of the SACK and timestamps tests */
+static uint8_t test_options[20];
+static size_t test_options_len;
+
 static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 					      uint16_t src_port,
 					      uint16_t dst_port,
@@ -264,11 +273,17 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
 	struct net_pkt *pkt;
 	struct tcphdr *th;
+	const uint8_t *opts = NULL;
 	uint8_t opts_len = 0;
 	int ret = -EINVAL;
 
 	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
+		opts = tcp_options;
 		opts_len = sizeof(tcp_options);
+	} else if ((test_case_no == TEST_CLIENT_SACK_IPV4) ||
+		   (test_case_no == TEST_CLIENT_TIMESTAMPS_IPV4)) {
+		opts = test_options;
+		opts_len = test_options_len;
 	}
 
 	/* Allocate buffer */
@@ -303,14 +318,15 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 	th->th_sport = src_port;
 	th->th_dport = dst_port;
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
-		th->th_off = 10U;
+	th->th_off = 5U + opts_len / 4U;
+	th->th_flags = flags;
+
+	if ((test_case_no == TEST_CLIENT_SACK_IPV4) ||
+	    (test_case_no == TEST_CLIENT_TIMESTAMPS_IPV4)) {
+		th->th_win = htons(NET_IPV6_MTU);
 	} else {
-		th->th_off = 5U;
+		th->th_win = NET_IPV6_MTU;
 	}
-
-	th->th_flags = flags;
-	th->th_win = NET_IPV6_MTU;
 	th->th_seq = htonl(seq);
 
 	if (ACK & flags) {
@@ -322,9 +338,9 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 		goto fail;
 	}
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
+	if (opts_len) {
 		/* Add TCP Options */
-		ret = net_pkt_write(pkt, tcp_options, opts_len);
+		ret = net_pkt_write(pkt, opts, opts_len);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -509,6 +525,12 @@ static int tester_send(const struct device *dev, struct net_pkt *pkt)
 	case TEST_CLIENT_FIN_ACK_WITH_DATA:
 		handle_client_fin_ack_with_data_test(net_pkt_family(pkt), &th);
 		break;
+	case TEST_CLIENT_SACK_IPV4:
+		handle_client_sack_test(pkt, &th);
+		break;
+	case TEST_CLIENT_TIMESTAMPS_IPV4:
+		handle_client_timestamps_test(pkt, &th);
+		break;
 
 	default:
 		zassert_true(false, "Undefined test case");
@@ -2090,9 +2112,9 @@ struct out_of_order_check_struct {
 static struct out_of_order_check_struct out_of_order_check_list[] = {
 	{ 30, 10, 0, 0}, /* First packet will be out-of-order */
 	{ 20, 12, 0, 0},
-	{ 10,  9, 0, 0}, /* Section with a gap */
-	{ 0,  10, 10, 0},
-	{ 10, 10, 40, 0}, /* First sequence complete */
+	{ 10,  9, 0, 0}, /* Section with a gap, queued as a separate run */
+	{ 0,  10, 19, 0}, /* First run delivered */
+	{ 19,  1, 40, 0}, /* Gap filled, second run delivered */
 	{ 50,  6, 40, 0},
 	{ 50,  3, 40, 0}, /* Discardable packet */
 	{ 55,  5, 40, 0},
@@ -2621,4 +2643,522 @@ ZTEST(net_tcp, test_client_fin_ack_with_data)
 	}
 }
 
+#define SACK_TEST_MSS 100
+#define SACK_TEST_SEGMENTS 7
+#define SACK_TEST_LOST (BIT(1) | BIT(3))
+#define SACK_TEST_OOO_SEGMENTS 2
+
+static const uint8_t sack_test_syn_options[] = {
+	0x02, 0x04, 0x00, SACK_TEST_MSS, /* Max segment */
+	0x01, 0x01, /* NOP */
+	0x04, 0x02, /* SACK permitted */
+};
+
+static uint32_t sack_test_base;
+static uint16_t sack_test_port;
+static uint32_t sack_test_seen;
+static uint32_t sack_test_received;
+static int sack_test_ooo;
+
+static size_t read_tcp_options(struct net_pkt *pkt, struct tcphdr *th,
+			       uint8_t *buf)
+{
+	size_t len = (th->th_off - 5U) * 4U;
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	if (net_pkt_skip(pkt, net_pkt_ip_hdr_len(pkt) +
+			 net_pkt_ip_opts_len(pkt) + sizeof(struct tcphdr)) < 0 ||
+	    net_pkt_read(pkt, buf, len) < 0) {
+		len = 0;
+	}
+
+	net_pkt_cursor_init(pkt);
+
+	return len;
+}
+
+static const uint8_t *find_tcp_option(const uint8_t *opts, size_t len,
+				      uint8_t kind)
+{
+	size_t i = 0;
+
+	while (i < len && opts[i] != NET_TCP_END_OPT) {
+		if (opts[i] == NET_TCP_NOP_OPT) {
+			i++;
+			continue;
+		}
+
+		if (i + 1 >= len || opts[i + 1] < 2) {
+			break;
+		}
+
+		if (opts[i] == kind) {
+			return &opts[i];
+		}
+
+		i += opts[i + 1];
+	}
+
+	return NULL;
+}
+
+/* SACK the segments received above the first missing one */
+static void set_sack_test_blocks(uint32_t received)
+{
+	uint8_t *opt = test_options;
+	int blocks = 0;
+	int i = 0;
+
+	while (received & BIT(i)) {
+		i++;
+	}
+
+	for ( ; i < SACK_TEST_SEGMENTS; i++) {
+		uint8_t *block = &opt[4 + blocks * NET_TCP_SACK_BLOCK_SIZE];
+
+		if (!(received & BIT(i))) {
+			continue;
+		}
+
+		UNALIGNED_PUT(htonl(sack_test_base + i * SACK_TEST_MSS),
+			      (uint32_t *)block);
+
+		while (i < SACK_TEST_SEGMENTS && (received & BIT(i))) {
+			i++;
+		}
+
+		UNALIGNED_PUT(htonl(sack_test_base + i * SACK_TEST_MSS),
+			      (uint32_t *)(block + 4));
+		blocks++;
+	}
+
+	if (blocks == 0) {
+		return;
+	}
+
+	opt[0] = NET_TCP_NOP_OPT;
+	opt[1] = NET_TCP_NOP_OPT;
+	opt[2] = NET_TCP_SACK_OPT;
+	opt[3] = 2 + blocks * NET_TCP_SACK_BLOCK_SIZE;
+	test_options_len = 4 + blocks * NET_TCP_SACK_BLOCK_SIZE;
+}
+
+static void handle_client_sack_test(struct net_pkt *pkt, struct tcphdr *th)
+{
+	uint8_t opts[40];
+	const uint8_t *opt;
+	struct net_pkt *reply;
+	size_t opts_len;
+	int i;
+	int ret;
+
+	opts_len = read_tcp_options(pkt, th, opts);
+	test_options_len = 0;
+
+	switch (t_state) {
+	case T_SYN:
+		test_verify_flags(th, SYN);
+		zassert_not_null(find_tcp_option(opts, opts_len, NET_TCP_SACK_PERM_OPT),
+				 "SYN without SACK permitted");
+		seq = 0U;
+		ack = ntohl(th->th_seq) + 1U;
+		sack_test_base = ack;
+		sack_test_port = th->th_sport;
+
+		memcpy(test_options, sack_test_syn_options,
+		       sizeof(sack_test_syn_options));
+		test_options_len = sizeof(sack_test_syn_options);
+
+		reply = prepare_syn_ack_packet(AF_INET, htons(MY_PORT), th->th_sport);
+		seq++;
+		t_state = T_SYN_ACK;
+		break;
+	case T_SYN_ACK:
+		test_verify_flags(th, ACK);
+		t_state = T_DATA;
+		test_sem_give();
+		return;
+	case T_DATA:
+		test_verify_flags(th, PSH | ACK);
+		i = (ntohl(th->th_seq) - sack_test_base) / SACK_TEST_MSS;
+
+		if (sack_test_seen & BIT(i)) {
+			/* Only the lost segments may be sent again */
+			zassert_true(SACK_TEST_LOST & BIT(i),
+				     "Unexpected retransmission of segment %d", i);
+		} else {
+			sack_test_seen |= BIT(i);
+
+			if (SACK_TEST_LOST & BIT(i)) {
+				/* Lost on the way */
+				return;
+			}
+		}
+
+		sack_test_received |= BIT(i);
+
+		i = 0;
+		while (sack_test_received & BIT(i)) {
+			i++;
+		}
+
+		ack = sack_test_base + i * SACK_TEST_MSS;
+
+		if (i < SACK_TEST_SEGMENTS) {
+			set_sack_test_blocks(sack_test_received);
+		} else {
+			t_state = T_SACK;
+			test_sem_give();
+		}
+
+		reply = prepare_ack_packet(AF_INET, htons(MY_PORT), th->th_sport);
+		break;
+	case T_SACK:
+		/* Each run of out-of-order data is reported back in a SACK
+		 * block, the most recently received one first.
+		 */
+		test_verify_flags(th, ACK);
+		zassert_equal(ntohl(th->th_ack), seq, "Unexpected ACK");
+		opt = find_tcp_option(opts, opts_len, NET_TCP_SACK_OPT);
+		zassert_not_null(opt, "ACK without SACK block");
+		zassert_equal(opt[1], 2 + sack_test_ooo * NET_TCP_SACK_BLOCK_SIZE);
+
+		for (i = 0; i < sack_test_ooo; i++) {
+			const uint8_t *block = &opt[2 + i * NET_TCP_SACK_BLOCK_SIZE];
+			uint32_t start = seq + (2 * (sack_test_ooo - i) - 1) * SACK_TEST_MSS;
+
+			zassert_equal(ntohl(UNALIGNED_GET((uint32_t *)&block[0])),
+				      start, "Unexpected SACK block %d start", i);
+			zassert_equal(ntohl(UNALIGNED_GET((uint32_t *)&block[4])),
+				      start + SACK_TEST_MSS, "Unexpected SACK block %d end", i);
+		}
+
+		if (sack_test_ooo == SACK_TEST_OOO_SEGMENTS) {
+			t_state = T_FIN;
+		}
+
+		test_sem_give();
+		return;
+	case T_FIN:
+		test_verify_flags(th, FIN | ACK);
+		ack = ack + 1U;
+		t_state = T_FIN_ACK;
+		reply = prepare_fin_ack_packet(AF_INET, htons(MY_PORT), th->th_sport);
+		break;
+	case T_FIN_ACK:
+		test_verify_flags(th, ACK);
+		test_sem_give();
+		return;
+	default:
+		zassert_true(false, "%s unexpected state", __func__);
+		return;
+	}
+
+	ret = net_recv_data(net_iface, reply);
+	if (ret < 0) {
+		goto fail;
+	}
+
+	return;
+fail:
+	zassert_true(false, "%s failed", __func__);
+}
+
+/* Test case scenario IPv4
+ *   expect SYN with SACK permitted,
+ *   send SYN ACK with SACK permitted,
+ *   expect ACK,
+ *   expect seven data segments, lose the second and the fourth one
+ *   and send duplicate ACKs with SACK blocks for the others,
+ *   expect both lost segments, and only them, to be sent again before
+ *   the retransmission timer expires,
+ *   send ACKs,
+ *   send two out-of-order segments separated by holes,
+ *   expect ACKs with a SACK block for each of them, the latest first,
+ *   expect FIN ACK,
+ *   send FIN ACK,
+ *   expect ACK.
+ *   any failures cause test case to fail.
+ */
+ZTEST(net_tcp, test_client_sack_ipv4)
+{
+	struct net_context *ctx;
+	struct net_pkt *pkt;
+	int ret;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_TCP_SACK);
+
+	t_state = T_SYN;
+	test_case_no = TEST_CLIENT_SACK_IPV4;
+	seq = ack = 0;
+	sack_test_seen = 0U;
+	sack_test_received = 0U;
+	sack_test_ooo = 0;
+
+	ret = net_context_get(AF_INET, SOCK_STREAM, IPPROTO_TCP, &ctx);
+	zassert_equal(ret, 0, "Failed to get net_context");
+
+	net_context_ref(ctx);
+
+	ret = net_context_connect(ctx, (struct sockaddr *)&peer_addr_s,
+				  sizeof(struct sockaddr_in), NULL,
+				  K_MSEC(100), NULL);
+	zassert_equal(ret, 0, "Failed to connect to peer");
+
+	/* Peer will release the semaphore after it receives
+	 * proper ACK to SYN | ACK
+	 */
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	ret = net_context_send(ctx, lorem_ipsum, SACK_TEST_MSS * SACK_TEST_SEGMENTS,
+			       NULL, K_NO_WAIT, NULL);
+	zassert_equal(ret, SACK_TEST_MSS * SACK_TEST_SEGMENTS,
+		      "Failed to send data to peer");
+
+	/* Peer will release the semaphore after it receives all the data.
+	 * NewReno would only resend the fourth segment after a timeout.
+	 */
+	test_sem_take(K_MSEC(CONFIG_NET_TCP_INIT_RETRANSMISSION_TIMEOUT / 2), __LINE__);
+
+	/* Send data beyond a hole, twice */
+	while (sack_test_ooo < SACK_TEST_OOO_SEGMENTS) {
+		uint32_t offset = (2 * sack_test_ooo + 1) * SACK_TEST_MSS;
+
+		seq += offset;
+		pkt = prepare_data_packet(AF_INET, htons(MY_PORT), sack_test_port,
+					  lorem_ipsum + offset, SACK_TEST_MSS);
+		seq -= offset;
+		zassert_not_null(pkt, "Cannot create pkt");
+
+		sack_test_ooo++;
+		ret = net_recv_data(net_iface, pkt);
+		zassert_equal(ret, 0, "recv data failed (%d)", ret);
+
+		test_sem_take(K_MSEC(100), __LINE__);
+	}
+
+	net_context_put(ctx);
+
+	/* Peer will release the semaphore after it receives
+	 * proper ACK to FIN | ACK
+	 */
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	/* Connection is in TIME_WAIT state, context will be released
+	 * after K_MSEC(CONFIG_NET_TCP_TIME_WAIT_DELAY), so wait for it.
+	 */
+	k_sleep(K_MSEC(CONFIG_NET_TCP_TIME_WAIT_DELAY));
+}
+
+#define TS_TEST_PEER_TS 1000
+#define TS_TEST_RTT 50
+
+static uint32_t ts_test_peer_ts;
+static uint16_t ts_test_port;
+
+static void set_ts_test_option(uint32_t tsval, uint32_t tsecr)
+{
+	test_options[0] = NET_TCP_NOP_OPT;
+	test_options[1] = NET_TCP_NOP_OPT;
+	test_options[2] = NET_TCP_TIMESTAMP_OPT;
+	test_options[3] = NET_TCP_TIMESTAMP_SIZE;
+	UNALIGNED_PUT(htonl(tsval), (uint32_t *)&test_options[4]);
+	UNALIGNED_PUT(htonl(tsecr), (uint32_t *)&test_options[8]);
+	test_options_len = 12;
+}
+
+static void handle_client_timestamps_test(struct net_pkt *pkt, struct tcphdr *th)
+{
+	uint8_t opts[40];
+	const uint8_t *opt;
+	struct net_pkt *reply;
+	size_t opts_len;
+	uint32_t tsval, tsecr;
+	bool data_acked = false;
+	int ret;
+
+	opts_len = read_tcp_options(pkt, th, opts);
+	opt = find_tcp_option(opts, opts_len, NET_TCP_TIMESTAMP_OPT);
+	zassert_not_null(opt, "Segment without timestamp");
+	zassert_equal(opt[1], NET_TCP_TIMESTAMP_SIZE);
+	tsval = ntohl(UNALIGNED_GET((uint32_t *)&opt[2]));
+	tsecr = ntohl(UNALIGNED_GET((uint32_t *)&opt[6]));
+
+	switch (t_state) {
+	case T_SYN:
+		test_verify_flags(th, SYN);
+		zassert_equal(tsecr, 0, "SYN echoes a timestamp");
+		seq = 0U;
+		ack = ntohl(th->th_seq) + 1U;
+		ts_test_peer_ts = TS_TEST_PEER_TS;
+		ts_test_port = th->th_sport;
+		set_ts_test_option(ts_test_peer_ts, tsval);
+		reply = prepare_syn_ack_packet(AF_INET, htons(MY_PORT), th->th_sport);
+		test_options_len = 0;
+		seq++;
+		t_state = T_SYN_ACK;
+		break;
+	case T_SYN_ACK:
+		test_verify_flags(th, ACK);
+		zassert_equal(tsecr, ts_test_peer_ts, "Timestamp not echoed");
+		t_state = T_DATA;
+		test_sem_give();
+		return;
+	case T_DATA:
+		test_verify_flags(th, PSH | ACK);
+		ack = ack + 1U;
+
+		/* Echo an older timestamp to pretend a longer round trip */
+		set_ts_test_option(++ts_test_peer_ts, tsval - TS_TEST_RTT);
+		reply = prepare_ack_packet(AF_INET, htons(MY_PORT), th->th_sport);
+		test_options_len = 0;
+		t_state = T_DATA_ACK;
+		data_acked = true;
+		break;
+	case T_DATA_ACK:
+		test_verify_flags(th, ACK);
+		zassert_equal(ntohl(th->th_ack), expected_ack, "Unexpected ACK");
+		test_sem_give();
+		return;
+	case T_FIN:
+		test_verify_flags(th, FIN | ACK);
+		ack = ack + 1U;
+		set_ts_test_option(++ts_test_peer_ts, tsval);
+		t_state = T_FIN_ACK;
+		reply = prepare_fin_ack_packet(AF_INET, htons(MY_PORT), th->th_sport);
+		test_options_len = 0;
+		break;
+	case T_FIN_ACK:
+		test_verify_flags(th, ACK);
+		test_sem_give();
+		return;
+	default:
+		zassert_true(false, "%s unexpected state", __func__);
+		return;
+	}
+
+	ret = net_recv_data(net_iface, reply);
+	if (ret < 0) {
+		goto fail;
+	}
+
+	if (data_acked) {
+		/* Let the test continue once the ACK is queued */
+		test_sem_give();
+	}
+
+	return;
+fail:
+	zassert_true(false, "%s failed", __func__);
+}
+
+static void verify_rtt_samples(struct net_context *ctx)
+{
+#if defined(CONFIG_NET_TCP_TIMESTAMPS)
+	struct tcp *conn = ctx->tcp;
+
+	/* One sample from the handshake, one from the data */
+	zassert_equal(conn->rtt.samples, 2, "Unexpected number of RTT samples");
+	zassert_true(conn->rtt.last >= TS_TEST_RTT &&
+		     conn->rtt.last < TS_TEST_RTT + 20,
+		     "Unexpected RTT %u", conn->rtt.last);
+	zassert_true(conn->rtt.rto >= 200, "RTO %u below its minimum",
+		     conn->rtt.rto);
+#else
+	ARG_UNUSED(ctx);
+#endif
+}
+
+/* Test case scenario IPv4
+ *   expect SYN with a timestamp,
+ *   send SYN ACK echoing it,
+ *   expect ACK echoing the timestamp of the SYN ACK,
+ *   expect data,
+ *   send ACK echoing an older timestamp of the device,
+ *   send data with an old timestamp,
+ *   expect ACK without the data being accepted,
+ *   send data with a newer timestamp,
+ *   expect ACK for it,
+ *   expect FIN ACK,
+ *   send FIN ACK,
+ *   expect ACK.
+ *   any failures cause test case to fail.
+ */
+ZTEST(net_tcp, test_client_timestamps_ipv4)
+{
+	struct net_context *ctx;
+	struct net_pkt *pkt;
+	uint8_t data = 0x41; /* "A" */
+	int ret;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_TCP_TIMESTAMPS);
+
+	t_state = T_SYN;
+	test_case_no = TEST_CLIENT_TIMESTAMPS_IPV4;
+	seq = ack = 0;
+
+	ret = net_context_get(AF_INET, SOCK_STREAM, IPPROTO_TCP, &ctx);
+	zassert_equal(ret, 0, "Failed to get net_context");
+
+	net_context_ref(ctx);
+
+	ret = net_context_connect(ctx, (struct sockaddr *)&peer_addr_s,
+				  sizeof(struct sockaddr_in), NULL,
+				  K_MSEC(100), NULL);
+	zassert_equal(ret, 0, "Failed to connect to peer");
+
+	/* Peer will release the semaphore after it receives
+	 * proper ACK to SYN | ACK
+	 */
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	ret = net_context_send(ctx, &data, 1, NULL, K_NO_WAIT, NULL);
+	zassert_equal(ret, 1, "Failed to send data to peer");
+
+	/* Peer will release the semaphore after it sends ACK for data */
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	/* Data with a timestamp older than the last one is dropped */
+	set_ts_test_option(TS_TEST_PEER_TS - 1, 0);
+	pkt = prepare_data_packet(AF_INET, htons(MY_PORT), ts_test_port, &data, 1);
+	zassert_not_null(pkt, "Cannot create pkt");
+
+	expected_ack = seq;
+	ret = net_recv_data(net_iface, pkt);
+	zassert_equal(ret, 0, "recv data failed (%d)", ret);
+
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	verify_rtt_samples(ctx);
+
+	set_ts_test_option(ts_test_peer_ts + 1, 0);
+	pkt = prepare_data_packet(AF_INET, htons(MY_PORT), ts_test_port, &data, 1);
+	zassert_not_null(pkt, "Cannot create pkt");
+
+	expected_ack = seq + 1;
+	ret = net_recv_data(net_iface, pkt);
+	zassert_equal(ret, 0, "recv data failed (%d)", ret);
+
+	/* The ACK may be delayed */
+	test_sem_take(K_MSEC(200), __LINE__);
+
+	seq++;
+	ts_test_peer_ts++;
+	t_state = T_FIN;
+
+	net_context_put(ctx);
+
+	/* Peer will release the semaphore after it receives
+	 * proper ACK to FIN | ACK
+	 */
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	/* Connection is in TIME_WAIT state, context will be released
+	 * after K_MSEC(CONFIG_NET_TCP_TIME_WAIT_DELAY), so wait for it.
+	 */
+	k_sleep(K_MSEC(CONFIG_NET_TCP_TIME_WAIT_DELAY));
+}
+
 ZTEST_SUITE(net_tcp, NULL, presetup, NULL, NULL, NULL);